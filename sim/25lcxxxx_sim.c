@@ -0,0 +1,1107 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_sim.c
+*@brief    	Host simulator of 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_SIM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Bit accurate model of 25LCxxxx device on virtual clock, used instead
+* 	of "25lcxxxx_if.c" to build and run driver on host.
+*
+* 	Model covers complete instruction set, WEL/WIP/BP/WPEN status bits,
+* 	page buffer wrap-around, address wrap-around, A8 address bit inside
+* 	opcode of 9 bit devices, write cycle and erase times, release time
+* 	from deep power-down and write cycles of each page. Commands not
+* 	accepted by real device (during write cycle, without WEL, into
+* 	protected area or in deep power-down) are ignored and counted.
+*
+* 	Virtual clock is shared by all simulated devices and advances only
+* 	with bus transfers, interface calls and delays, so each run is
+* 	deterministic.
+*
+* 	"_25lcxxxx_if_*" functions are bound to default device, additional
+* 	devices are accessed by "_25lcxxxx_sim_transmit/receive".
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "25lcxxxx_sim.h"
+#include "../src/25lcxxxx_regdef.h"
+#include "../../25lcxxxx_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Opcode bit holding A8 address bit of 9 bit devices
+ */
+#define _25LCXXXX_SIM_OPCODE_A8_MASK		( 0x08U )
+
+/**
+ * 	Status register bits
+ */
+#define _25LCXXXX_SIM_STATUS_WIP			( 0x01U )
+#define _25LCXXXX_SIM_STATUS_WEL			( 0x02U )
+#define _25LCXXXX_SIM_STATUS_NV_MASK		( 0x8CU )
+
+/**
+ * 	Number of sectors
+ */
+#define _25LCXXXX_SIM_SECTOR_NUM			( 4UL )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Virtual clock
+ *
+ * 	Unit: nanoseconds
+ */
+static uint64_t g_25lcxxxx_sim_time_ns = 0;
+
+/**
+ * 	Device bound to "_25lcxxxx_if_*" functions
+ */
+static _25lcxxxx_sim_t g_25lcxxxx_sim;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void			_25lcxxxx_sim_update			(_25lcxxxx_sim_t * const p_sim);
+static bool			_25lcxxxx_sim_is_busy			(_25lcxxxx_sim_t * const p_sim);
+static uint32_t		_25lcxxxx_sim_addr_bytes		(const _25lcxxxx_sim_t * const p_sim);
+static uint8_t		_25lcxxxx_sim_opcode			(const _25lcxxxx_sim_t * const p_sim);
+static bool			_25lcxxxx_sim_has_addr			(const _25lcxxxx_sim_t * const p_sim, const uint8_t opcode);
+static bool			_25lcxxxx_sim_is_protected		(const _25lcxxxx_sim_t * const p_sim, const uint32_t addr, const uint32_t size);
+static void			_25lcxxxx_sim_start_cycle		(_25lcxxxx_sim_t * const p_sim, const uint32_t time_us);
+static void			_25lcxxxx_sim_wear				(_25lcxxxx_sim_t * const p_sim, const uint32_t addr, const uint32_t size);
+static void			_25lcxxxx_sim_cs_low			(_25lcxxxx_sim_t * const p_sim);
+static void			_25lcxxxx_sim_cs_high			(_25lcxxxx_sim_t * const p_sim);
+static void			_25lcxxxx_sim_execute			(_25lcxxxx_sim_t * const p_sim);
+static void			_25lcxxxx_sim_shift_in			(_25lcxxxx_sim_t * const p_sim, const uint8_t data);
+static uint8_t		_25lcxxxx_sim_shift_out			(_25lcxxxx_sim_t * const p_sim);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize simulated device
+*
+* @brief	Memory array is erased (0xFF), status register and
+* 			statistics are cleared.
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @param[in]	p_cfg	- Pointer to configuration, NULL for default
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_sim_init(_25lcxxxx_sim_t * const p_sim, const _25lcxxxx_sim_cfg_t * const p_cfg)
+{
+	_25LCXXXX_ASSERT( NULL != p_sim );
+
+	if ( NULL != p_cfg )
+	{
+		p_sim->cfg = *p_cfg;
+	}
+	else
+	{
+		_25lcxxxx_sim_get_default_cfg( &p_sim->cfg );
+	}
+
+	_25LCXXXX_ASSERT(( p_sim->cfg.addr_bits >= 7U ) && ( p_sim->cfg.addr_bits <= 17U ));
+	_25LCXXXX_ASSERT(( p_sim->cfg.page_size >= 16U ) && ( p_sim->cfg.page_size <= 256U ));
+	_25LCXXXX_ASSERT( 0U == ( p_sim->cfg.page_size & ( p_sim->cfg.page_size - 1U )));
+	_25LCXXXX_ASSERT( p_sim->cfg.spi_clk_hz > 0UL );
+
+	memset( p_sim->mem, 0xFF, sizeof( p_sim->mem ));
+	memset( p_sim->page_cycles, 0, sizeof( p_sim->page_cycles ));
+	memset( &p_sim->stats, 0, sizeof( p_sim->stats ));
+
+	// Time of 8 clocks
+	p_sim->byte_ns = ( 8000000000ULL / p_sim->cfg.spi_clk_hz );
+
+	p_sim->status = 0U;
+
+	_25lcxxxx_sim_power_cycle( p_sim );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Power cycle simulated device
+*
+* @brief	Volatile state is lost: write cycle in progress is
+* 			completed, WEL is reset and device leaves deep power-down.
+* 			Memory array, block protection and page cycles are kept.
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_sim_power_cycle(_25lcxxxx_sim_t * const p_sim)
+{
+	_25LCXXXX_ASSERT( NULL != p_sim );
+
+	p_sim->status 		&= _25LCXXXX_SIM_STATUS_NV_MASK;
+	p_sim->busy_until	= 0ULL;
+	p_sim->cmd_cnt		= 0UL;
+	p_sim->data_cnt		= 0UL;
+	p_sim->is_cs		= false;
+	p_sim->is_cycle		= false;
+	p_sim->is_down		= false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clock bytes into simulated device
+*
+* @param[in]	p_sim		- Pointer to simulated device
+* @param[in]	p_data		- Pointer to transmit data
+* @param[in]	size		- Size of transmit data
+* @param[in]	cs_action	- Chip select action
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_sim_transmit(_25lcxxxx_sim_t * const p_sim, const uint8_t * p_data, const uint32_t size, const spi_cs_action_t cs_action)
+{
+	_25LCXXXX_ASSERT( NULL != p_sim );
+	_25LCXXXX_ASSERT(( NULL != p_data ) || ( 0UL == size ));
+
+	if ( cs_action & eSPI_CS_LOW_ON_ENTRY )
+	{
+		_25lcxxxx_sim_cs_low( p_sim );
+	}
+
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		_25lcxxxx_sim_shift_in( p_sim, p_data[i] );
+	}
+
+	if ( cs_action & eSPI_CS_HIGH_ON_EXIT )
+	{
+		_25lcxxxx_sim_cs_high( p_sim );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clock bytes out of simulated device
+*
+* @param[in]	p_sim		- Pointer to simulated device
+* @param[out]	p_data		- Pointer to receive data
+* @param[in]	size		- Size of receive data
+* @param[in]	cs_action	- Chip select action
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_sim_receive(_25lcxxxx_sim_t * const p_sim, uint8_t * p_data, const uint32_t size, const spi_cs_action_t cs_action)
+{
+	_25LCXXXX_ASSERT( NULL != p_sim );
+	_25LCXXXX_ASSERT(( NULL != p_data ) || ( 0UL == size ));
+
+	if ( cs_action & eSPI_CS_LOW_ON_ENTRY )
+	{
+		_25lcxxxx_sim_cs_low( p_sim );
+	}
+
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		p_data[i] = _25lcxxxx_sim_shift_out( p_sim );
+	}
+
+	if ( cs_action & eSPI_CS_HIGH_ON_EXIT )
+	{
+		_25lcxxxx_sim_cs_high( p_sim );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get simulated device statistics
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @param[out]	p_stats	- Pointer to statistics
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_sim_get_stats(const _25lcxxxx_sim_t * const p_sim, _25lcxxxx_sim_stats_t * const p_stats)
+{
+	_25LCXXXX_ASSERT( NULL != p_sim );
+	_25LCXXXX_ASSERT( NULL != p_stats );
+
+	*p_stats = p_sim->stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Reset simulated device statistics
+*
+* @note	Page cycles are not reset as they describe wear of memory array.
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_sim_reset_stats(_25lcxxxx_sim_t * const p_sim)
+{
+	uint32_t max_page_cycles = 0;
+
+	_25LCXXXX_ASSERT( NULL != p_sim );
+
+	max_page_cycles = p_sim->stats.max_page_cycles;
+
+	memset( &p_sim->stats, 0, sizeof( p_sim->stats ));
+
+	p_sim->stats.max_page_cycles = max_page_cycles;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get simulated device bound to "_25lcxxxx_if_*" functions
+*
+* @note	Device is initialized with default configuration by
+* 		"_25lcxxxx_if_init" unless it was initialized before.
+*
+* @return 		p_sim - Pointer to default simulated device
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_sim_t * _25lcxxxx_sim_get_default(void)
+{
+	return &g_25lcxxxx_sim;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get default simulated device configuration
+*
+* @brief	25LC640A (13 address bits, 32 byte page) on 10 MHz SPI with
+* 			typical timing.
+*
+* @param[out]	p_cfg	- Pointer to configuration
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_sim_get_default_cfg(_25lcxxxx_sim_cfg_t * const p_cfg)
+{
+	_25LCXXXX_ASSERT( NULL != p_cfg );
+
+	p_cfg->addr_bits	= 13U;
+	p_cfg->page_size	= 32U;
+	p_cfg->ext_isa		= false;
+	p_cfg->signature	= 0x29U;
+	p_cfg->spi_clk_hz	= 10000000UL;
+	p_cfg->t_wc_us		= 3000UL;
+	p_cfg->t_erase_us	= 10000UL;
+	p_cfg->t_rel_us		= 100UL;
+	p_cfg->t_call_ns	= 200UL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get virtual time
+*
+* @return 		time_ns - Virtual time in nanoseconds
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint64_t _25lcxxxx_sim_get_time_ns(void)
+{
+	return g_25lcxxxx_sim_time_ns;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Advance virtual time
+*
+* @note	Used to model time spent by application between driver calls.
+*
+* @param[in]	ns	- Time in nanoseconds
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_sim_advance_ns(const uint64_t ns)
+{
+	g_25lcxxxx_sim_time_ns += ns;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_SIM_KERNEL
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Complete write cycle when its time expired
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_sim_update(_25lcxxxx_sim_t * const p_sim)
+{
+	if (	( true == p_sim->is_cycle )
+		&&	( g_25lcxxxx_sim_time_ns >= p_sim->busy_until ))
+	{
+		p_sim->is_cycle = false;
+
+		// WEL is reset at completion of write cycle
+		p_sim->status &= ~_25LCXXXX_SIM_STATUS_WEL;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if device accepts only status read
+*
+* @note	True during write cycle and release from deep power-down.
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @return 		busy 	- Device busy
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool _25lcxxxx_sim_is_busy(_25lcxxxx_sim_t * const p_sim)
+{
+	_25lcxxxx_sim_update( p_sim );
+
+	return ( g_25lcxxxx_sim_time_ns < p_sim->busy_until );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get number of address bytes in command
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @return 		bytes 	- Number of address bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t _25lcxxxx_sim_addr_bytes(const _25lcxxxx_sim_t * const p_sim)
+{
+	uint32_t bytes = 3UL;
+
+	if ( p_sim->cfg.addr_bits <= 9U )
+	{
+		bytes = 1UL;
+	}
+	else if ( p_sim->cfg.addr_bits <= 16U )
+	{
+		bytes = 2UL;
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return bytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get opcode of current frame
+*
+* @note	Opcode bit 3 of devices with single address byte is A8 address
+* 		bit (9 bit devices) or don't care (7 & 8 bit devices).
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @return 		opcode 	- Opcode without address bit
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t _25lcxxxx_sim_opcode(const _25lcxxxx_sim_t * const p_sim)
+{
+	uint8_t opcode = p_sim->cmd[0];
+
+	if ( 1UL == _25lcxxxx_sim_addr_bytes( p_sim ))
+	{
+		const uint8_t base = ( opcode & ~_25LCXXXX_SIM_OPCODE_A8_MASK );
+
+		if (( e25LCXXXX_ISA_READ == base ) || ( e25LCXXXX_ISA_WRITE == base ))
+		{
+			opcode = base;
+		}
+	}
+
+	return opcode;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if opcode is followed by address
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @param[in]	opcode	- Opcode
+* @return 		has_addr - Address follows opcode
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool _25lcxxxx_sim_has_addr(const _25lcxxxx_sim_t * const p_sim, const uint8_t opcode)
+{
+	bool has_addr = false;
+
+	if (( e25LCXXXX_ISA_READ == opcode ) || ( e25LCXXXX_ISA_WRITE == opcode ))
+	{
+		has_addr = true;
+	}
+	else if (	( true == p_sim->cfg.ext_isa )
+			&&	(	( e25LCXXXX_ISA_PE == opcode )
+				||	( e25LCXXXX_ISA_SE == opcode )
+				||	( e25LCXXXX_ISA_RDID == opcode )))
+	{
+		has_addr = true;
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return has_addr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if any byte of memory region is write protected
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @param[in]	addr	- Start address of region
+* @param[in]	size	- Size of region
+* @return 		protected - Region write protected
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool _25lcxxxx_sim_is_protected(const _25lcxxxx_sim_t * const p_sim, const uint32_t addr, const uint32_t size)
+{
+	const uint32_t 	mem_size 	= ( 1UL << p_sim->cfg.addr_bits );
+	const uint32_t 	bp 			= (( p_sim->status >> 2U ) & 0x03U );
+	uint32_t		start		= mem_size;
+
+	// Start of protected area
+	if ( 1UL == bp )
+	{
+		start = (( mem_size / 4UL ) * 3UL );
+	}
+	else if ( 2UL == bp )
+	{
+		start = ( mem_size / 2UL );
+	}
+	else if ( 3UL == bp )
+	{
+		start = 0UL;
+	}
+	else
+	{
+		// No actions...
+	}
+
+	return (( addr + size ) > start );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start write cycle
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @param[in]	time_us	- Duration of write cycle
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_sim_start_cycle(_25lcxxxx_sim_t * const p_sim, const uint32_t time_us)
+{
+	p_sim->is_cycle			= true;
+	p_sim->busy_until		= g_25lcxxxx_sim_time_ns + ( time_us * 1000ULL );
+	p_sim->stats.busy_ns	+= ( time_us * 1000ULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Account write cycle of each page of memory region
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @param[in]	addr	- Start address of page aligned region
+* @param[in]	size	- Size of region
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_sim_wear(_25lcxxxx_sim_t * const p_sim, const uint32_t addr, const uint32_t size)
+{
+	for ( uint32_t page = ( addr / p_sim->cfg.page_size ); page < (( addr + size ) / p_sim->cfg.page_size ); page++ )
+	{
+		p_sim->page_cycles[page]++;
+
+		if ( p_sim->page_cycles[page] > p_sim->stats.max_page_cycles )
+		{
+			p_sim->stats.max_page_cycles = p_sim->page_cycles[page];
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Assert chip select
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_sim_cs_low(_25lcxxxx_sim_t * const p_sim)
+{
+	p_sim->is_cs 	= true;
+	p_sim->cmd_cnt	= 0UL;
+	p_sim->data_cnt	= 0UL;
+	p_sim->addr		= 0UL;
+
+	memset( p_sim->page_mask, 0, sizeof( p_sim->page_mask ));
+
+	p_sim->stats.cs_cnt++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Release chip select
+*
+* @note	Write, erase, latch and power-down commands take effect here.
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_sim_cs_high(_25lcxxxx_sim_t * const p_sim)
+{
+	if (( true == p_sim->is_cs ) && ( p_sim->cmd_cnt > 0UL ))
+	{
+		_25lcxxxx_sim_execute( p_sim );
+	}
+
+	p_sim->is_cs = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Execute command of completed frame
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_sim_execute(_25lcxxxx_sim_t * const p_sim)
+{
+	const uint8_t 	opcode 		= _25lcxxxx_sim_opcode( p_sim );
+	const uint32_t	mem_size	= ( 1UL << p_sim->cfg.addr_bits );
+	const uint32_t	page_size	= p_sim->cfg.page_size;
+	const uint32_t	hdr_size	= ( 1UL + ( _25lcxxxx_sim_has_addr( p_sim, opcode ) ? _25lcxxxx_sim_addr_bytes( p_sim ) : 0UL ));
+	const bool		is_wel		= ( 0U != ( p_sim->status & _25LCXXXX_SIM_STATUS_WEL ));
+	bool			accepted	= false;
+
+	// Only release from deep power-down
+	if ( true == p_sim->is_down )
+	{
+		if (( e25LCXXXX_ISA_RDID == opcode ) && ( p_sim->cmd_cnt >= hdr_size ))
+		{
+			p_sim->is_down 		= false;
+			p_sim->busy_until	= g_25lcxxxx_sim_time_ns + ( p_sim->cfg.t_rel_us * 1000ULL );
+			p_sim->stats.wake_cnt++;
+		}
+		else
+		{
+			p_sim->stats.reject_cnt++;
+		}
+
+		return;
+	}
+
+	// Only status read during write cycle
+	if ( true == _25lcxxxx_sim_is_busy( p_sim ))
+	{
+		if ( e25LCXXXX_ISA_RDST != opcode )
+		{
+			p_sim->stats.reject_cnt++;
+		}
+
+		return;
+	}
+
+	// Incomplete command
+	if ( p_sim->cmd_cnt < hdr_size )
+	{
+		p_sim->stats.reject_cnt++;
+
+		return;
+	}
+
+	switch( opcode )
+	{
+		case e25LCXXXX_ISA_READ:
+		case e25LCXXXX_ISA_RDST:
+			accepted = true;
+			break;
+
+		case e25LCXXXX_ISA_WREN:
+			p_sim->status |= _25LCXXXX_SIM_STATUS_WEL;
+			accepted = true;
+			break;
+
+		case e25LCXXXX_ISA_WRDI:
+			p_sim->status &= ~_25LCXXXX_SIM_STATUS_WEL;
+			accepted = true;
+			break;
+
+		case e25LCXXXX_ISA_WDST:
+			if (( true == is_wel ) && ( p_sim->data_cnt > 0UL ))
+			{
+				p_sim->status = (( p_sim->status & ~_25LCXXXX_SIM_STATUS_NV_MASK ) | ( p_sim->page_buf[0] & _25LCXXXX_SIM_STATUS_NV_MASK ));
+				_25lcxxxx_sim_start_cycle( p_sim, p_sim->cfg.t_wc_us );
+				accepted = true;
+			}
+			break;
+
+		case e25LCXXXX_ISA_WRITE:
+			if (	( true == is_wel )
+				&&	( p_sim->data_cnt > 0UL )
+				&&	( false == _25lcxxxx_sim_is_protected( p_sim, ( p_sim->addr & ~( page_size - 1UL )), page_size )))
+			{
+				const uint32_t page_addr = ( p_sim->addr & ~( page_size - 1UL ));
+
+				// Program latched bytes of page buffer
+				for ( uint32_t i = 0; i < page_size; i++ )
+				{
+					if ( true == p_sim->page_mask[i] )
+					{
+						p_sim->mem[ page_addr + i ] = p_sim->page_buf[i];
+					}
+				}
+
+				_25lcxxxx_sim_wear( p_sim, page_addr, page_size );
+				_25lcxxxx_sim_start_cycle( p_sim, p_sim->cfg.t_wc_us );
+				p_sim->stats.prog_cnt++;
+				accepted = true;
+			}
+			break;
+
+		case e25LCXXXX_ISA_PE:
+		case e25LCXXXX_ISA_SE:
+		case e25LCXXXX_ISA_CE:
+			if (( true == p_sim->cfg.ext_isa ) && ( true == is_wel ))
+			{
+				uint32_t size = mem_size;
+				uint32_t addr = 0UL;
+
+				if ( e25LCXXXX_ISA_PE == opcode )
+				{
+					size = page_size;
+				}
+				else if ( e25LCXXXX_ISA_SE == opcode )
+				{
+					size = ( mem_size / _25LCXXXX_SIM_SECTOR_NUM );
+				}
+				else
+				{
+					// No actions...
+				}
+
+				addr = ( p_sim->addr & ~( size - 1UL ));
+
+				if ( false == _25lcxxxx_sim_is_protected( p_sim, addr, size ))
+				{
+					memset( &p_sim->mem[addr], 0xFF, size );
+
+					_25lcxxxx_sim_wear( p_sim, addr, size );
+					_25lcxxxx_sim_start_cycle( p_sim, (( e25LCXXXX_ISA_PE == opcode ) ? p_sim->cfg.t_wc_us : p_sim->cfg.t_erase_us ));
+					p_sim->stats.erase_cnt++;
+					accepted = true;
+				}
+			}
+			break;
+
+		case e25LCXXXX_ISA_RDID:
+			accepted = p_sim->cfg.ext_isa;
+			break;
+
+		case e25LCXXXX_ISA_DPD:
+			if ( true == p_sim->cfg.ext_isa )
+			{
+				p_sim->is_down = true;
+				accepted = true;
+			}
+			break;
+
+		default:
+			// No actions...
+			break;
+	}
+
+	if ( false == accepted )
+	{
+		p_sim->stats.reject_cnt++;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clock single byte into device
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @param[in]	data	- Byte on MOSI line
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_sim_shift_in(_25lcxxxx_sim_t * const p_sim, const uint8_t data)
+{
+	const uint32_t addr_bytes = _25lcxxxx_sim_addr_bytes( p_sim );
+
+	g_25lcxxxx_sim_time_ns += p_sim->byte_ns;
+	p_sim->stats.tx_bytes++;
+
+	// Ignored without chip select
+	if ( false == p_sim->is_cs )
+	{
+		return;
+	}
+
+	// Opcode
+	if ( 0UL == p_sim->cmd_cnt )
+	{
+		p_sim->cmd[0] 	= data;
+		p_sim->cmd_cnt	= 1UL;
+	}
+
+	// Address
+	else if (	( true == _25lcxxxx_sim_has_addr( p_sim, _25lcxxxx_sim_opcode( p_sim )))
+			&&	( p_sim->cmd_cnt <= addr_bytes ))
+	{
+		p_sim->cmd[ p_sim->cmd_cnt ] = data;
+		p_sim->cmd_cnt++;
+
+		if ( p_sim->cmd_cnt > addr_bytes )
+		{
+			for ( uint32_t i = 1; i <= addr_bytes; i++ )
+			{
+				p_sim->addr = (( p_sim->addr << 8U ) | p_sim->cmd[i] );
+			}
+
+			// A8 inside opcode
+			if (( 9U == p_sim->cfg.addr_bits ) && ( p_sim->cmd[0] & _25LCXXXX_SIM_OPCODE_A8_MASK ))
+			{
+				p_sim->addr |= 0x100UL;
+			}
+
+			p_sim->addr &= (( 1UL << p_sim->cfg.addr_bits ) - 1UL );
+		}
+	}
+
+	// Data
+	else
+	{
+		if ( e25LCXXXX_ISA_WRITE == _25lcxxxx_sim_opcode( p_sim ))
+		{
+			// Page buffer wraps around
+			const uint32_t offset = (( p_sim->addr + p_sim->data_cnt ) & ( p_sim->cfg.page_size - 1UL ));
+
+			p_sim->page_buf[offset] 	= data;
+			p_sim->page_mask[offset] 	= true;
+		}
+		else if ( 0UL == p_sim->data_cnt )
+		{
+			p_sim->page_buf[0] = data;
+		}
+		else
+		{
+			// No actions...
+		}
+
+		p_sim->data_cnt++;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Clock single byte out of device
+*
+* @param[in]	p_sim	- Pointer to simulated device
+* @return 		data	- Byte on MISO line, 0xFF when not driven
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t _25lcxxxx_sim_shift_out(_25lcxxxx_sim_t * const p_sim)
+{
+	const uint8_t 	opcode 		= _25lcxxxx_sim_opcode( p_sim );
+	const uint32_t	hdr_size	= ( 1UL + ( _25lcxxxx_sim_has_addr( p_sim, opcode ) ? _25lcxxxx_sim_addr_bytes( p_sim ) : 0UL ));
+	uint8_t			data		= 0xFFU;
+
+	g_25lcxxxx_sim_time_ns += p_sim->byte_ns;
+	p_sim->stats.rx_bytes++;
+
+	if (( false == p_sim->is_cs ) || ( p_sim->cmd_cnt < hdr_size ))
+	{
+		return data;
+	}
+
+	// Signature is output also in deep power-down
+	if (( true == p_sim->cfg.ext_isa ) && ( e25LCXXXX_ISA_RDID == opcode ))
+	{
+		data = p_sim->cfg.signature;
+	}
+	else if ( true == p_sim->is_down )
+	{
+		// Not driven...
+	}
+	else if ( e25LCXXXX_ISA_RDST == opcode )
+	{
+		// Count each status read once
+		if ( 0UL == p_sim->data_cnt )
+		{
+			p_sim->stats.rdsr_cnt++;
+		}
+
+		_25lcxxxx_sim_update( p_sim );
+
+		data = ( p_sim->status | ( p_sim->is_cycle ? _25LCXXXX_SIM_STATUS_WIP : 0U ));
+	}
+	else if (( e25LCXXXX_ISA_READ == opcode ) && ( false == _25lcxxxx_sim_is_busy( p_sim )))
+	{
+		// Address wraps around at end of memory array
+		data = p_sim->mem[ p_sim->addr ];
+		p_sim->addr = (( p_sim->addr + 1UL ) & (( 1UL << p_sim->cfg.addr_bits ) - 1UL ));
+	}
+	else
+	{
+		// No actions...
+	}
+
+	p_sim->data_cnt++;
+
+	return data;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_IF
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Interface functions bound to default simulated device. Each call
+* 	costs "t_call_ns" of virtual time.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize low level interface
+*
+* @return 		status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_if_init(void)
+{
+	// Not initialized by application
+	if ( 0ULL == g_25lcxxxx_sim.byte_ns )
+	{
+		_25lcxxxx_sim_init( &g_25lcxxxx_sim, NULL );
+	}
+
+	g_25lcxxxx_sim_time_ns += g_25lcxxxx_sim.cfg.t_call_ns;
+
+	return e25LCXXXX_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write bytes via SPI to device
+*
+* @param[in] 	p_data		- Pointer to transmit data
+* @param[in] 	size		- Size of transmit data
+* @param[in] 	cs_action	- Chip select action
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_if_transmit(const uint8_t * p_data, const uint32_t size, const spi_cs_action_t cs_action)
+{
+	g_25lcxxxx_sim_time_ns += g_25lcxxxx_sim.cfg.t_call_ns;
+
+	_25lcxxxx_sim_transmit( &g_25lcxxxx_sim, p_data, size, cs_action );
+
+	return e25LCXXXX_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read bytes via SPI from device
+*
+* @param[in] 	p_data		- Pointer to receive data
+* @param[in] 	size		- Size of received data
+* @param[in] 	cs_action	- Chip select action
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_if_receive(uint8_t * p_data, const uint32_t size, const spi_cs_action_t cs_action)
+{
+	g_25lcxxxx_sim_time_ns += g_25lcxxxx_sim.cfg.t_call_ns;
+
+	_25lcxxxx_sim_receive( &g_25lcxxxx_sim, p_data, size, cs_action );
+
+	return e25LCXXXX_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Transfer list of segments via SPI within single transaction
+*
+* @param[in] 	p_iov		- Pointer to list of segments
+* @param[in] 	iov_cnt		- Number of segments
+* @param[in] 	cs_action	- Chip select action of whole transaction
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_if_transmitv(const _25lcxxxx_iovec_t * p_iov, const uint32_t iov_cnt, const spi_cs_action_t cs_action)
+{
+	g_25lcxxxx_sim_time_ns += g_25lcxxxx_sim.cfg.t_call_ns;
+
+	for ( uint32_t i = 0; i < iov_cnt; i++ )
+	{
+		uint32_t seg_cs_action = 0;
+
+		// Chip select only at start and end of whole transaction
+		if ( 0 == i )
+		{
+			seg_cs_action |= ( cs_action & eSPI_CS_LOW_ON_ENTRY );
+		}
+		if (( iov_cnt - 1 ) == i )
+		{
+			seg_cs_action |= ( cs_action & eSPI_CS_HIGH_ON_EXIT );
+		}
+
+		if ( NULL != p_iov[i].p_tx )
+		{
+			_25lcxxxx_sim_transmit( &g_25lcxxxx_sim, p_iov[i].p_tx, p_iov[i].size, (spi_cs_action_t) seg_cs_action );
+		}
+		else
+		{
+			_25lcxxxx_sim_receive( &g_25lcxxxx_sim, p_iov[i].p_rx, p_iov[i].size, (spi_cs_action_t) seg_cs_action );
+		}
+	}
+
+	return e25LCXXXX_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get system timetick in millisecond
+*
+* @return 		time_ms	- Virtual time in milisecond
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t _25lcxxxx_if_get_sys_time_ms(void)
+{
+	g_25lcxxxx_sim_time_ns += g_25lcxxxx_sim.cfg.t_call_ns;
+
+	return (uint32_t)( g_25lcxxxx_sim_time_ns / 1000000ULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Delay for microseconds
+*
+* @param[in] 	us	- Delay time in microseconds
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_if_delay_us(const uint32_t us)
+{
+	g_25lcxxxx_sim_time_ns += ( us * 1000ULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get system time in microseconds
+*
+* @return 		time_us	- Virtual time in microseconds
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t _25lcxxxx_if_get_sys_time_us(void)
+{
+	g_25lcxxxx_sim_time_ns += g_25lcxxxx_sim.cfg.t_call_ns;
+
+	return (uint32_t)( g_25lcxxxx_sim_time_ns / 1000ULL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Lock access to device
+*
+* @note		Host build is single threaded, only cost of call is simulated.
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_if_lock(void)
+{
+	g_25lcxxxx_sim_time_ns += g_25lcxxxx_sim.cfg.t_call_ns;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Unlock access to device
+*
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void _25lcxxxx_if_unlock(void)
+{
+	g_25lcxxxx_sim_time_ns += g_25lcxxxx_sim.cfg.t_call_ns;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate CRC-32
+*
+* @note		Bitwise reference implementation, stands in for CRC peripheral.
+*
+* @param[in]	crc		- Previous CRC value, 0 for first block
+* @param[in]	p_data	- Pointer to data
+* @param[in]	size	- Size of data
+* @return 		crc		- Calculated CRC
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t _25lcxxxx_if_crc32(const uint32_t crc, const uint8_t * const p_data, const uint32_t size)
+{
+	uint32_t c = ~crc;
+
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		c ^= p_data[i];
+
+		for ( uint8_t b = 0; b < 8U; b++ )
+		{
+			c = ( c & 1UL ) ? (( c >> 1U ) ^ 0xEDB88320UL ) : ( c >> 1U );
+		}
+	}
+
+	return ~c;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,136 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_sim.h
+*@brief    	Host simulator of 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_SIM
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _25LCXXXX_SIM_H_
+#define _25LCXXXX_SIM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "../src/25lcxxxx.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Largest simulated memory array
+ *
+ * 	Unit: bytes
+ */
+#define _25LCXXXX_SIM_SIZE_MAX				( 1UL << 17 )
+
+/**
+ * 	Largest number of simulated pages (smallest page is 16 bytes)
+ */
+#define _25LCXXXX_SIM_PAGE_NUM_MAX			( _25LCXXXX_SIM_SIZE_MAX / 16UL )
+
+/**
+ * 	SPI chip select actions
+ *
+ * 	@note	Host replacement of platform SPI driver definitions. Include
+ * 			this header instead of platform SPI driver in "25lcxxxx_if.h".
+ */
+typedef enum
+{
+	eSPI_CS_NONE			= 0x00,		/**<Chip select untouched */
+	eSPI_CS_LOW_ON_ENTRY	= 0x01,		/**<Chip select asserted before transfer */
+	eSPI_CS_HIGH_ON_EXIT	= 0x02,		/**<Chip select released after transfer */
+} spi_cs_action_t;
+
+/**
+ * 	Simulated device configuration
+ */
+typedef struct
+{
+	uint8_t		addr_bits;		/**<Number of address bits, 7-17 */
+	uint16_t	page_size;		/**<Page size in bytes, 16-256 */
+	bool		ext_isa;		/**<Page/sector/chip erase and deep power-down supported */
+	uint8_t		signature;		/**<Electronic signature returned by RDID */
+	uint32_t	spi_clk_hz;		/**<SPI clock in Hz */
+	uint32_t	t_wc_us;		/**<Write cycle time (write, status write, page erase) in us */
+	uint32_t	t_erase_us;		/**<Sector & chip erase time in us */
+	uint32_t	t_rel_us;		/**<Release from deep power-down time in us */
+	uint32_t	t_call_ns;		/**<Host cost of each interface call in ns */
+} _25lcxxxx_sim_cfg_t;
+
+/**
+ * 	Simulated device statistics
+ */
+typedef struct
+{
+	uint32_t	cs_cnt;				/**<Number of chip select frames */
+	uint32_t	rdsr_cnt;			/**<Number of status register reads */
+	uint32_t	prog_cnt;			/**<Number of page programs */
+	uint32_t	erase_cnt;			/**<Number of page/sector/chip erases */
+	uint32_t	reject_cnt;			/**<Number of ignored commands (busy, WEL, protection or power-down) */
+	uint32_t	wake_cnt;			/**<Number of releases from deep power-down */
+	uint32_t	max_page_cycles;	/**<Highest number of write cycles of single page */
+	uint64_t	rx_bytes;			/**<Number of bytes clocked out of device */
+	uint64_t	tx_bytes;			/**<Number of bytes clocked into device */
+	uint64_t	busy_ns;			/**<Total time of write cycles in ns */
+} _25lcxxxx_sim_stats_t;
+
+/**
+ * 	Simulated device
+ *
+ * 	@note	Memory array and page cycle counters are public for inspection
+ * 			and fault injection. They are kept over power cycle.
+ */
+typedef struct
+{
+	_25lcxxxx_sim_cfg_t		cfg;										/**<Configuration */
+	_25lcxxxx_sim_stats_t	stats;										/**<Statistics */
+	uint8_t					mem[_25LCXXXX_SIM_SIZE_MAX];				/**<Memory array */
+	uint32_t				page_cycles[_25LCXXXX_SIM_PAGE_NUM_MAX];	/**<Write cycles by page */
+	uint64_t				byte_ns;									/**<Time of single byte on bus */
+	uint64_t				busy_until;									/**<End of write cycle or power-down release */
+	uint8_t					status;										/**<Status register */
+	uint8_t					cmd[4];										/**<Opcode & address bytes */
+	uint32_t				cmd_cnt;									/**<Number of received command bytes */
+	uint32_t				addr;										/**<Current address */
+	uint32_t				data_cnt;									/**<Number of data bytes in frame */
+	uint8_t					page_buf[256];								/**<Page buffer */
+	bool					page_mask[256];								/**<Written bytes of page buffer */
+	bool					is_cs;										/**<Chip select asserted */
+	bool					is_cycle;									/**<Write cycle in progress */
+	bool					is_down;									/**<Deep power-down */
+} _25lcxxxx_sim_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+void					_25lcxxxx_sim_init				(_25lcxxxx_sim_t * const p_sim, const _25lcxxxx_sim_cfg_t * const p_cfg);
+void					_25lcxxxx_sim_power_cycle		(_25lcxxxx_sim_t * const p_sim);
+void					_25lcxxxx_sim_transmit			(_25lcxxxx_sim_t * const p_sim, const uint8_t * p_data, const uint32_t size, const spi_cs_action_t cs_action);
+void					_25lcxxxx_sim_receive			(_25lcxxxx_sim_t * const p_sim, uint8_t * p_data, const uint32_t size, const spi_cs_action_t cs_action);
+void					_25lcxxxx_sim_get_stats			(const _25lcxxxx_sim_t * const p_sim, _25lcxxxx_sim_stats_t * const p_stats);
+void					_25lcxxxx_sim_reset_stats		(_25lcxxxx_sim_t * const p_sim);
+_25lcxxxx_sim_t *		_25lcxxxx_sim_get_default		(void);
+void					_25lcxxxx_sim_get_default_cfg	(_25lcxxxx_sim_cfg_t * const p_cfg);
+uint64_t				_25lcxxxx_sim_get_time_ns		(void);
+void					_25lcxxxx_sim_advance_ns		(const uint64_t ns);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // _25LCXXXX_SIM_H_
@@ -7,7 +7,7 @@
 *@brief     API for 25LCxxxx EEPROM device
 *@author    Ziga Miklosic
 *@date      08.05.2021
-*@version	V1.0.2
+*@version	V1.1.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -21,32 +21,151 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
 #include "25lcxxxx.h"
 #include "25lcxxxx_regdef.h"
 #include "../../25lcxxxx_if.h"
 #include "../../25lcxxxx_cfg.h"
 
+#if ( 1 == _25LCXXXX_CFG_JNL_EN )
+	#include "25lcxxxx_jnl.h"
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
- *  Highest memory address
+ * 	Maximum write cycle time of parts
+ *
+ * 	@note	25XX1024 is slowest, its time is assumed for unknown part.
+ *
+ * 	Unit: microseconds
  */
-#define _25LCXXXX_MAX_ADDR					((uint32_t) (( 1UL << _25LCXXXX_CFG_ADDR_BIT_NUM ) - 1UL ))
+#define _25LCXXXX_TWC_MAX_US_25XX1024		( 6000UL )
+#define _25LCXXXX_TWC_MAX_US_OTHER			( 5000UL )
 
 /**
- * 	Write in progress wait timeout
+ * 	Write in progress wait timeout of device instance
+ *
+ * 	@note	Maximum write cycle time of device rounded up.
  *
  * 	Unit: miliseconds
  */
-#define _25LCXXXX_WAIT_WRITE_TIMEOUT_MS		( 5UL )
+#define _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev )	((( p_dev )->cfg.twc_max_us + 999UL ) / 1000UL )
+
+/**
+ * 	Write cycle time of device instance after which page program is over for sure
+ *
+ * 	Unit: microseconds
+ */
+#define _25LCXXXX_WAIT_TWC_MAX_US( p_dev )			(( p_dev )->cfg.twc_max_us )
+
+/**
+ * 	Geometry and supported instructions of device instance
+ *
+ * 	With part selected by "_25LCXXXX_CFG_PART" all instances are that
+ * 	part. Page size, page mask, command size and supported instructions
+ * 	are then constants of part profile, so that page math compiles into
+ * 	masks, command framing is fixed and unsupported instructions are
+ * 	removed by compiler.
+ */
+#if ( _25LCXXXX_PART_CUSTOM == _25LCXXXX_CFG_PART )
+	#define _25LCXXXX_DEV_PAGE_SIZE( p_dev )			((uint32_t) ( p_dev )->cfg.page_size )
+	#define _25LCXXXX_DEV_PAGE_MASK( p_dev )			( ( p_dev )->page_mask )
+	#define _25LCXXXX_DEV_CMD_SIZE( p_dev )				( ( p_dev )->cmd_size )
+	#define _25LCXXXX_DEV_HAS_FEAT( p_dev, feat )		( true == ( p_dev )->cfg.ext_isa )
+#else
+	#define _25LCXXXX_DEV_PAGE_SIZE( p_dev )			((uint32_t) _25LCXXXX_PART_PAGE_SIZE )
+	#define _25LCXXXX_DEV_PAGE_MASK( p_dev )			((uint32_t) ( _25LCXXXX_PART_PAGE_SIZE - 1UL ))
+	#define _25LCXXXX_DEV_CMD_SIZE( p_dev )				((uint8_t) _25LCXXXX_PART_CMD_SIZE )
+	#define _25LCXXXX_DEV_HAS_FEAT( p_dev, feat )		( 0U != ( _25LCXXXX_PART_FEAT & ( feat )))
+#endif
+
+/**
+ * 	Supported range of address bits
+ */
+#define _25LCXXXX_ADDR_BIT_NUM_MIN			( 7U )
+#define _25LCXXXX_ADDR_BIT_NUM_MAX			( 17U )
+
+/**
+ * 	Supported range of page size
+ *
+ * 	Unit: bytes
+ */
+#define _25LCXXXX_PAGE_SIZE_MIN				( 16U )
+#define _25LCXXXX_PAGE_SIZE_MAX				( 256U )
+
+/**
+ * 	Address bit 8 position in command of 9 bit address devices
+ */
+#define _25LCXXXX_A8_CMD_MASK				( 0x08U )
 
 /**
  * 	Erase value
  */
 #define _25LCXXX_ERASE_VALUE				((uint8_t)( 0xFFU ))
 
+/**
+ * 	Erase value repeated, for blank page initialization
+ */
+#define _25LCXXXX_ERASE_VALUE_X4			_25LCXXX_ERASE_VALUE, _25LCXXX_ERASE_VALUE, _25LCXXX_ERASE_VALUE, _25LCXXX_ERASE_VALUE
+#define _25LCXXXX_ERASE_VALUE_X16			_25LCXXXX_ERASE_VALUE_X4, _25LCXXXX_ERASE_VALUE_X4, _25LCXXXX_ERASE_VALUE_X4, _25LCXXXX_ERASE_VALUE_X4
+#define _25LCXXXX_ERASE_VALUE_X64			_25LCXXXX_ERASE_VALUE_X16, _25LCXXXX_ERASE_VALUE_X16, _25LCXXXX_ERASE_VALUE_X16, _25LCXXXX_ERASE_VALUE_X16
+
+/**
+ * 	Number of sectors of memory array
+ */
+#define _25LCXXXX_SECTOR_NUM				( 4UL )
+
+/**
+ * 	Release from deep power-down time
+ *
+ *	Unit: microseconds
+ */
+#define _25LCXXXX_DPD_RELEASE_TIME_US		( 100UL )
+
+/**
+ * 	Timeout of page, sector & chip erase
+ *
+ *	Unit: miliseconds
+ */
+#define _25LCXXXX_WAIT_ERASE_TIMEOUT_MS		( 15UL )
+
+/**
+ * 	Electronic signature of devices with extended instruction set
+ */
+#define _25LCXXXX_SIGNATURE					( 0x29U )
+
+/**
+ * 	Probed geometry cache record
+ *
+ * 	Magic, address bits, page size log2 and check byte.
+ */
+#define _25LCXXXX_DETECT_MAGIC				( 0xA7U )
+#define _25LCXXXX_DETECT_REC_SIZE			( 4UL )
+
+/**
+ * 	Learned write cycle time is shortened by this fraction when
+ * 	device was already idle at first status read
+ */
+#define _25LCXXXX_TWC_SHRINK_DIV			( 64UL )
+
+/**
+ * 	Weight of new measurement in learned write cycle time
+ */
+#define _25LCXXXX_TWC_LEARN_DIV				( 8UL )
+
+/**
+ * 	Add to performance counter
+ */
+#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+	#define _25LCXXXX_STATS_ADD(p_dev,cnt,val)		{ (p_dev)->stats.cnt += (val); }
+#else
+	#define _25LCXXXX_STATS_ADD(p_dev,cnt,val)		{ ; }
+#endif
+
 /**
  * 	Read/Write memory command
  */
@@ -65,25 +184,136 @@ typedef union
 ////////////////////////////////////////////////////////////////////////////////
 
 /**
- * 	Initialization guard
+ * 	Interface of default device
+ */
+static const _25lcxxxx_if_t g_25lcxxxx_if =
+{
+	.pf_init			= _25lcxxxx_if_init,
+	.pf_transmit		= _25lcxxxx_if_transmit,
+	.pf_receive			= _25lcxxxx_if_receive,
+
+	#if ( 1 == _25LCXXXX_CFG_IF_TRANSMITV_EN )
+		.pf_transmitv	= _25lcxxxx_if_transmitv,
+	#else
+		.pf_transmitv	= NULL,
+	#endif
+
+	.pf_get_sys_time_ms	= _25lcxxxx_if_get_sys_time_ms,
+
+	#if ( 1 == _25LCXXXX_CFG_IF_DELAY_US_EN )
+		.pf_delay_us	= _25lcxxxx_if_delay_us,
+	#else
+		.pf_delay_us	= NULL,
+	#endif
+
+	#if ( 1 == _25LCXXXX_CFG_IF_TIME_US_EN )
+		.pf_get_sys_time_us	= _25lcxxxx_if_get_sys_time_us,
+	#else
+		.pf_get_sys_time_us	= NULL,
+	#endif
+
+	#if ( 1 == _25LCXXXX_CFG_IF_LOCK_EN )
+		.pf_lock		= _25lcxxxx_if_lock,
+		.pf_unlock		= _25lcxxxx_if_unlock,
+	#else
+		.pf_lock		= NULL,
+		.pf_unlock		= NULL,
+	#endif
+};
+
+/**
+ * 	Configuration of default device
+ */
+static const _25lcxxxx_dev_cfg_t g_25lcxxxx_dev_cfg =
+{
+	.p_if		= &g_25lcxxxx_if,
+	.addr_bits	= _25LCXXXX_CFG_ADDR_BIT_NUM,
+	.page_size	= _25LCXXXX_CFG_PAGE_SIZE_BYTE,
+	.ext_isa	= ( 1 == _25LCXXXX_CFG_EXT_ISA_EN ),
+	.dpd_timeout_ms	= _25LCXXXX_CFG_DPD_TIMEOUT_MS,
+	.detect			= ( 1 == _25LCXXXX_CFG_DETECT_EN ),
+	.detect_addr	= _25LCXXXX_CFG_DETECT_ADDR,
+	.twc_max_us		= 0UL,
+
+	#if ( 1 == _25LCXXXX_CFG_JNL_EN )
+		.jnl_addr	= _25LCXXXX_CFG_JNL_ADDR,
+		.jnl_size	= _25LCXXXX_CFG_JNL_SIZE,
+	#else
+		.jnl_addr	= 0UL,
+		.jnl_size	= 0UL,
+	#endif
+};
+
+/**
+ * 	Default device
  */
-static bool gb_is_init = false;
+static _25lcxxxx_dev_t g_25lcxxxx_dev = { .is_init = false };
+
+/**
+ * 	Blank page, source of erase by programming
+ */
+static const uint8_t g_25lcxxxx_blank_page[ _25LCXXXX_PAGE_SIZE_MAX ] =
+{
+	_25LCXXXX_ERASE_VALUE_X64, _25LCXXXX_ERASE_VALUE_X64, _25LCXXXX_ERASE_VALUE_X64, _25LCXXXX_ERASE_VALUE_X64
+};
 
 ////////////////////////////////////////////////////////////////////////////////
 // Function Prototypes
 ////////////////////////////////////////////////////////////////////////////////
-static _25lcxxxx_status_t 	_25lcxxxx_write_enable 				(void);
-static _25lcxxxx_status_t 	_25lcxxxx_write_disable 			(void);
-static _25lcxxxx_status_t 	_25lcxxxx_read_status				(_25lcxxxx_status_reg_t * const p_status_reg);
-static _25lcxxxx_status_t 	_25lcxxxx_write_status				(const _25lcxxxx_status_reg_t * const p_status_reg);
-static _25lcxxxx_status_t 	_25lcxxxx_read_command				(const uint32_t addr);
-static _25lcxxxx_status_t 	_25lcxxxx_write_command				(const uint32_t addr);
-static void 				_25lcxxxx_assemble_rw_cmd			(_25lcxxxx_rw_cmd_t * const p_frame, const _25lcxxxx_isa_t rw_cmd, const uint32_t addr);
-static uint32_t 			_25lcxxxx_calc_num_of_sectors		(const uint32_t addr, const uint32_t size);
-static uint32_t 			_25lcxxxx_calc_transfer_size		(const uint32_t addr, const uint32_t size);
-static bool					_25lcxxxx_read_wip_flag				(void);
-static bool					_25lcxxxx_read_wel_flag				(void);
-static _25lcxxxx_status_t	_25lcxxxx_wait_for_write_process	(const uint32_t timeout);
+static _25lcxxxx_status_t 	_25lcxxxx_write_enable 				(_25lcxxxx_dev_t * const p_dev);
+static _25lcxxxx_status_t 	_25lcxxxx_write_disable 			(_25lcxxxx_dev_t * const p_dev);
+static _25lcxxxx_status_t 	_25lcxxxx_read_status				(_25lcxxxx_dev_t * const p_dev, _25lcxxxx_status_reg_t * const p_status_reg);
+static _25lcxxxx_status_t 	_25lcxxxx_write_status				(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_status_reg_t * const p_status_reg);
+static _25lcxxxx_status_t 	_25lcxxxx_transfer					(_25lcxxxx_dev_t * const p_dev, const uint8_t * const p_cmd, const uint32_t cmd_size, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size);
+static _25lcxxxx_status_t 	_25lcxxxx_read_command				(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, uint8_t * const p_data, const uint32_t size);
+static _25lcxxxx_status_t 	_25lcxxxx_write_command				(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint8_t * const p_data, const uint32_t size);
+static _25lcxxxx_status_t 	_25lcxxxx_program_page				(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+static _25lcxxxx_status_t 	_25lcxxxx_erase_command				(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_isa_t erase_cmd, const uint32_t addr);
+static _25lcxxxx_status_t 	_25lcxxxx_read_signature			(_25lcxxxx_dev_t * const p_dev, uint8_t * const p_sig);
+static _25lcxxxx_status_t 	_25lcxxxx_enter_power_down			(_25lcxxxx_dev_t * const p_dev);
+static _25lcxxxx_status_t 	_25lcxxxx_wake_up					(_25lcxxxx_dev_t * const p_dev);
+static void 				_25lcxxxx_set_geometry				(_25lcxxxx_dev_t * const p_dev, const uint8_t addr_bits, const uint16_t page_size);
+static _25lcxxxx_status_t 	_25lcxxxx_detect_geometry			(_25lcxxxx_dev_t * const p_dev);
+static _25lcxxxx_status_t 	_25lcxxxx_probe_addr_bits			(_25lcxxxx_dev_t * const p_dev, uint8_t * const p_addr_bits);
+static _25lcxxxx_status_t 	_25lcxxxx_probe_page_size			(_25lcxxxx_dev_t * const p_dev, uint16_t * const p_page_size);
+static _25lcxxxx_status_t 	_25lcxxxx_probe_read				(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, uint8_t * const p_val);
+static _25lcxxxx_status_t 	_25lcxxxx_probe_write				(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+static pf_25lcxxxx_async_cb_t	_25lcxxxx_async_finish			(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_status_t status);
+static _25lcxxxx_status_t	_25lcxxxx_async_step				(_25lcxxxx_dev_t * const p_dev, pf_25lcxxxx_async_cb_t * const p_pf_done);
+static void					_25lcxxxx_lock						(_25lcxxxx_dev_t * const p_dev);
+static void					_25lcxxxx_unlock					(_25lcxxxx_dev_t * const p_dev);
+static bool					_25lcxxxx_sleep_unlocked			(_25lcxxxx_dev_t * const p_dev, const uint32_t us);
+static void 				_25lcxxxx_assemble_rw_cmd			(const _25lcxxxx_dev_t * const p_dev, _25lcxxxx_rw_cmd_t * const p_frame, const _25lcxxxx_isa_t rw_cmd, const uint32_t addr);
+static uint32_t 			_25lcxxxx_calc_num_of_sectors		(const _25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size);
+static uint32_t 			_25lcxxxx_calc_transfer_size		(const _25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size);
+static bool					_25lcxxxx_writev_next_page			(const _25lcxxxx_dev_t * const p_dev, const _25lcxxxx_seg_t * const p_seg, const uint32_t seg_cnt, const uint32_t from, uint32_t * const p_page_addr);
+static void					_25lcxxxx_writev_merge				(const _25lcxxxx_dev_t * const p_dev, const _25lcxxxx_seg_t * const p_seg, const uint32_t seg_cnt, const uint32_t page_addr, uint8_t * const p_buf, bool * const p_is_set);
+static bool					_25lcxxxx_read_wip_flag				(_25lcxxxx_dev_t * const p_dev);
+static bool					_25lcxxxx_read_wel_flag				(_25lcxxxx_dev_t * const p_dev);
+static _25lcxxxx_status_t	_25lcxxxx_wait_for_write_process	(_25lcxxxx_dev_t * const p_dev, const uint32_t timeout);
+static _25lcxxxx_status_t	_25lcxxxx_wait_tick					(_25lcxxxx_dev_t * const p_dev, const uint32_t timeout);
+static _25lcxxxx_status_t	_25lcxxxx_wait_adaptive				(_25lcxxxx_dev_t * const p_dev, const uint32_t timeout);
+static void					_25lcxxxx_cycle_start				(_25lcxxxx_dev_t * const p_dev, const bool is_prog);
+static bool					_25lcxxxx_cycle_is_over				(_25lcxxxx_dev_t * const p_dev);
+static void					_25lcxxxx_learn_twc					(_25lcxxxx_dev_t * const p_dev, const uint32_t time_us, const bool is_busy);
+static void					_25lcxxxx_sleep_us					(_25lcxxxx_dev_t * const p_dev, const uint32_t us);
+
+#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN ) || ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+	static bool				_25lcxxxx_is_protected				(const _25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size);
+#endif
+
+#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+	static void				_25lcxxxx_stats_wear				(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size);
+	static void				_25lcxxxx_stats_wait				(_25lcxxxx_dev_t * const p_dev, const uint32_t wait_ms, const _25lcxxxx_status_t status);
+#endif
+
+#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+	static _25lcxxxx_status_t		_25lcxxxx_cache_read		(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+	static _25lcxxxx_cache_slot_t *	_25lcxxxx_cache_find		(_25lcxxxx_dev_t * const p_dev, const uint32_t page_addr);
+	static _25lcxxxx_status_t		_25lcxxxx_cache_load		(_25lcxxxx_dev_t * const p_dev, const uint32_t page_addr, bool * const p_is_ready, _25lcxxxx_cache_slot_t ** const pp_slot);
+	static void						_25lcxxxx_cache_update		(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+	static void						_25lcxxxx_cache_invalidate	(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size);
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -91,98 +321,262 @@ static _25lcxxxx_status_t	_25lcxxxx_wait_for_write_process	(const uint32_t timeo
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Initialize EEPROM device
+*		Initialize EEPROM device instance
 *
-* @return 	status - Status of initialization
+* @note		Configuration is copied into device context, so it does not
+* 			need to stay valid after call. Interface table must!
+*
+* @note		With geometry detection enabled configured number of address
+* 			bits only selects address size of command (1: 7-9 bits, 2: 10-16
+* 			bits, 3: 17 bits). Actual geometry is then detected.
+*
+* @param[in]	p_dev	- Pointer to device context
+* @param[in]	p_cfg	- Pointer to device configuration
+* @return 		status 	- Status of initialization
 */
 ////////////////////////////////////////////////////////////////////////////////
-_25lcxxxx_status_t _25lcxxxx_init(void)
+_25lcxxxx_status_t _25lcxxxx_dev_init(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_dev_cfg_t * const p_cfg)
 {
-	_25lcxxxx_status_t 	status 		= e25LCXXXX_OK;
-	bool				wel_flag	= false;
+	_25lcxxxx_status_t 		status 		= e25LCXXXX_OK;
+	bool					wel_flag	= false;
+	_25lcxxxx_status_reg_t	stat_reg	= { .u = 0 };
+
+	_25LCXXXX_ASSERT( NULL != p_dev );
+	_25LCXXXX_ASSERT( NULL != p_cfg );
+	_25LCXXXX_ASSERT( NULL != p_cfg->p_if );
 
 	// Check for init
-	_25LCXXXX_ASSERT( false == gb_is_init );
+	_25LCXXXX_ASSERT( false == p_dev->is_init );
+
+	// Invalid geometry
+	_25LCXXXX_ASSERT(( p_cfg->addr_bits >= _25LCXXXX_ADDR_BIT_NUM_MIN ) && ( p_cfg->addr_bits <= _25LCXXXX_ADDR_BIT_NUM_MAX ));
+	_25LCXXXX_ASSERT(( p_cfg->page_size >= _25LCXXXX_PAGE_SIZE_MIN ) && ( p_cfg->page_size <= _25LCXXXX_PAGE_SIZE_MAX ));
+	_25LCXXXX_ASSERT( 0U == ( p_cfg->page_size & ( p_cfg->page_size - 1U )));
+
+	// Deep power-down needs extended instruction set
+	_25LCXXXX_ASSERT(( 0UL == p_cfg->dpd_timeout_ms ) || ( true == p_cfg->ext_isa ));
+
+	#if ( _25LCXXXX_PART_CUSTOM != _25LCXXXX_CFG_PART )
+
+		// Instance must be selected part
+		_25LCXXXX_ASSERT( _25LCXXXX_PART_ADDR_BIT_NUM == p_cfg->addr_bits );
+		_25LCXXXX_ASSERT( _25LCXXXX_PART_PAGE_SIZE == p_cfg->page_size );
+		_25LCXXXX_ASSERT(( 1 == _25LCXXXX_CFG_EXT_ISA_EN ) == p_cfg->ext_isa );
+		_25LCXXXX_ASSERT( false == p_cfg->detect );
+
+	#endif
+
+	// Setup device geometry
+	p_dev->cfg = *p_cfg;
+	_25lcxxxx_set_geometry( p_dev, p_cfg->addr_bits, p_cfg->page_size );
+
+	// Maximum write cycle time of part, slowest part until known
+	if ( 0UL == p_cfg->twc_max_us )
+	{
+		#if ( _25LCXXXX_PART_CUSTOM == _25LCXXXX_CFG_PART )
+			p_dev->cfg.twc_max_us = _25LCXXXX_TWC_MAX_US_25XX1024;
+		#else
+			p_dev->cfg.twc_max_us = (uint32_t) _25LCXXXX_PART_TWC_MAX_US;
+		#endif
+	}
+
+	// No write job
+	p_dev->async.p_data 	= NULL;
+	p_dev->async.size 		= 0UL;
+	p_dev->async.pf_done 	= NULL;
+	p_dev->async.state 		= e25LCXXXX_ASYNC_IDLE;
+
+	#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN )
+
+		// Nothing programmed yet
+		p_dev->fwd.size = 0UL;
+
+	#endif
+
+	#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+
+		// Nothing cached yet
+		_25lcxxxx_cache_invalidate( p_dev, 0UL, ( p_dev->max_addr + 1UL ));
+		memset( &p_dev->cache.stats, 0, sizeof( p_dev->cache.stats ));
+		p_dev->cache.use_cnt 	= 0UL;
+		p_dev->cache.next_addr 	= 0UL;
+
+	#endif
+
+	// Device awake
+	p_dev->dpd.is_down = false;
+
+	// Start learning write cycle time from expected value
+	// NOTE: Write cycle started before reset might still run, device
+	// is asked at first wait
+	p_dev->cycle.is_active		= false;
+	p_dev->cycle.is_known		= false;
+	p_dev->cycle.is_prog		= false;
+	p_dev->cycle.stats.est_us	= _25LCXXXX_CFG_WAIT_TWC_US;
+	p_dev->cycle.stats.min_us	= 0UL;
+	p_dev->cycle.stats.max_us	= 0UL;
+	p_dev->cycle.stats.cnt		= 0UL;
+	p_dev->cycle.seq			= 0UL;
 
 	// Initialize app interface
-	status = _25lcxxxx_if_init();
+	status = p_dev->cfg.p_if->pf_init();
+
+	// Lock and unlock are set both or none
+	_25LCXXXX_ASSERT(( NULL == p_dev->cfg.p_if->pf_lock ) == ( NULL == p_dev->cfg.p_if->pf_unlock ));
+
+	_25lcxxxx_lock( p_dev );
+
+	// Release from deep power-down left by previous run
+	// NOTE: Device accepts commands only after release time!
+	if (	( e25LCXXXX_OK == status )
+		&&	( _25LCXXXX_DEV_HAS_FEAT( p_dev, _25LCXXXX_PART_FEAT_DPD )))
+	{
+		status = _25lcxxxx_wake_up( p_dev );
+	}
+
+	p_dev->dpd.stats.wake_cnt			= 0UL;
+	p_dev->dpd.stats.wake_latency_us	= 0UL;
+
+	#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+
+		// Count from initialization on
+		memset( &p_dev->stats, 0, sizeof( p_dev->stats ));
+
+	#endif
+
+	// Find out actual geometry
+	if (	( e25LCXXXX_OK == status )
+		&&	( true == p_dev->cfg.detect ))
+	{
+		status = _25lcxxxx_detect_geometry( p_dev );
+
+		// Only 25XX1024 has 17 address bits
+		if (	( e25LCXXXX_OK == status )
+			&&	( 0UL == p_cfg->twc_max_us )
+			&&	( _25LCXXXX_ADDR_BIT_NUM_MAX != p_dev->cfg.addr_bits ))
+		{
+			p_dev->cfg.twc_max_us = _25LCXXXX_TWC_MAX_US_OTHER;
+		}
+	}
+
+	#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN )
+
+		// Programmed data must fit into forwarding buffer
+		_25LCXXXX_ASSERT( _25LCXXXX_DEV_PAGE_SIZE( p_dev ) <= _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+
+	#endif
+
+	#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+
+		// Page must fit into cache slot
+		_25LCXXXX_ASSERT( _25LCXXXX_DEV_PAGE_SIZE( p_dev ) <= _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+
+	#endif
+
+	// Block protection kept from previous run
+	status |= _25lcxxxx_read_status( p_dev, &stat_reg );
+	p_dev->prot = (_25lcxxxx_protect_t) stat_reg.b.bp;
 
 	// Enable write latch
-	status |= _25lcxxxx_write_enable();
+	status |= _25lcxxxx_write_enable( p_dev );
 
 	// Read WEL flag
-	wel_flag = _25lcxxxx_read_wel_flag();
+	wel_flag = _25lcxxxx_read_wel_flag( p_dev );
 
 	if (	( e25LCXXXX_OK == status )
 		&& 	( true == wel_flag ))
 	{
-		gb_is_init = true;
+		p_dev->is_init = true;
 	}
 
+	_25lcxxxx_unlock( p_dev );
+
+	#if ( 1 == _25LCXXXX_CFG_JNL_EN )
+
+		// Complete transaction interrupted by reset
+		if (	( true == p_dev->is_init )
+			&&	( p_dev->cfg.jnl_size > 0UL ))
+		{
+			status = _25lcxxxx_jnl_recover( p_dev );
+		}
+
+	#endif
+
 	_25LCXXXX_ASSERT( e25LCXXXX_OK == status );
-	_25LCXXXX_ASSERT( true == gb_is_init );
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
 
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		De-Initialize EEPROM device
+*		De-Initialize EEPROM device instance
 *
-* @return 	status - Status of deinitialization
+* @param[in]	p_dev	- Pointer to device context
+* @return 		status 	- Status of deinitialization
 */
 ////////////////////////////////////////////////////////////////////////////////
-_25lcxxxx_status_t _25lcxxxx_deinit	(void)
+_25lcxxxx_status_t _25lcxxxx_dev_deinit(_25lcxxxx_dev_t * const p_dev)
 {
 	_25lcxxxx_status_t 		status 		= e25LCXXXX_OK;
 	_25lcxxxx_status_reg_t	stat_reg	= { .u = 0 };
 
+	_25LCXXXX_ASSERT( NULL != p_dev );
+
 	// Check for init
-	_25LCXXXX_ASSERT( true == gb_is_init );
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
+
+	_25lcxxxx_lock( p_dev );
 
 	// Disable write latch
-	status |= _25lcxxxx_write_disable();
+	status |= _25lcxxxx_write_disable( p_dev );
 
 	// Verify enable write latch
-	status |= _25lcxxxx_read_status( &stat_reg );
+	status |= _25lcxxxx_read_status( p_dev, &stat_reg );
 
 	if (	( e25LCXXXX_OK == status )
 		&& 	( false == stat_reg.b.wel ))
 	{
-		gb_is_init = false;
+		p_dev->is_init = false;
 	}
 
+	_25lcxxxx_unlock( p_dev );
+
 	_25LCXXXX_ASSERT( e25LCXXXX_OK == status );
-	_25LCXXXX_ASSERT( false == gb_is_init );
+	_25LCXXXX_ASSERT( false == p_dev->is_init );
 
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Is device initialized
+*		Is device instance initialized
 *
-* @return 	gb_is_init - Global initialization flag
+* @param[in]	p_dev	- Pointer to device context
+* @return 		is_init - Initialization flag of device
 */
 ////////////////////////////////////////////////////////////////////////////////
-const bool _25lcxxxx_is_init(void)
+const bool _25lcxxxx_dev_is_init(const _25lcxxxx_dev_t * const p_dev)
 {
-	return (const bool) gb_is_init;
+	_25LCXXXX_ASSERT( NULL != p_dev );
+
+	return (const bool) p_dev->is_init;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Write byte(s) to EEPROM
+*		Write byte(s) to EEPROM device instance
 *
 * @note		Need to be check for page boundary unless it wrap around!
 *
+* @param[in]	p_dev	- Pointer to device context
 * @param[in]	addr	- Start address of write
 * @param[in]	size	- Size of bytes to write
 * @param[in]	p_data	- Pointer to write data
 * @return 		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-_25lcxxxx_status_t _25lcxxxx_write(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+_25lcxxxx_status_t _25lcxxxx_dev_write(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
 {
 	_25lcxxxx_status_t 		status				= e25LCXXXX_OK;
 	uint32_t				working_addr		= addr;
@@ -190,29 +584,40 @@ _25lcxxxx_status_t _25lcxxxx_write(const uint32_t addr, const uint32_t size, con
 	uint32_t				bytes_to_transfer	= 0UL;
 	uint32_t				data_offset			= 0UL;
 
+	_25LCXXXX_ASSERT( NULL != p_dev );
+
 	// Check for init
-	_25LCXXXX_ASSERT( true == gb_is_init );
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
 
 	// Invalid inputs
 	_25LCXXXX_ASSERT( size > 0 );
-	_25LCXXXX_ASSERT(( addr + size - 1 ) <= _25LCXXXX_MAX_ADDR );
+	_25LCXXXX_ASSERT(( addr + size - 1 ) <= p_dev->max_addr );
+
+	_25lcxxxx_lock( p_dev );
+
+	// Non-blocking write in progress
+	if ( e25LCXXXX_ASYNC_BUSY == p_dev->async.state )
+	{
+		_25lcxxxx_unlock( p_dev );
+		return e25LCXXXX_ERROR_BUSY;
+	}
 
 	// Calculate how many sectors takes write request
-	const uint32_t num_of_sectors = _25lcxxxx_calc_num_of_sectors( addr, size );
+	const uint32_t num_of_sectors = _25lcxxxx_calc_num_of_sectors( p_dev, addr, size );
 
 	// Write to all sectors
 	for (uint32_t i = 0; i < num_of_sectors; i++ )
 	{
 		// Calculate bytes to transfer till end of page
-		bytes_to_transfer = _25lcxxxx_calc_transfer_size( working_addr, working_size );
+		bytes_to_transfer = _25lcxxxx_calc_transfer_size( p_dev, working_addr, working_size );
 
-		// Send write command
-		status = _25lcxxxx_write_command( working_addr );
+		// Wait for previous write process
+		status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
 
 		if ( e25LCXXXX_OK == status )
 		{
-			// Send data payload
-			status = _25lcxxxx_if_transmit( ( p_data + data_offset ), bytes_to_transfer, eSPI_CS_HIGH_ON_EXIT );
+			// Program page
+			status = _25lcxxxx_program_page( p_dev, working_addr, bytes_to_transfer, ( p_data + data_offset ));
 
 			// Increment address & written data offset
 			data_offset += bytes_to_transfer;
@@ -225,6 +630,8 @@ _25lcxxxx_status_t _25lcxxxx_write(const uint32_t addr, const uint32_t size, con
 		}
 	}
 
+	_25lcxxxx_unlock( p_dev );
+
 	// All bytes shall be transfered
 	_25LCXXXX_ASSERT( 0UL == working_size );
 
@@ -233,510 +640,3288 @@ _25lcxxxx_status_t _25lcxxxx_write(const uint32_t addr, const uint32_t size, con
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Erase byte(s) from EEPROM
+*		Write only changed byte(s) to EEPROM device instance
 *
-* @brief	This function erase number of bytes from eeprom device starting
-* 			from addr parameter. Erase value is defined by "_25LCXXX_ERASE_VALUE"
-* 			macro.
+* @brief	Each page is first read back and compared with new data. Pages
+* 			that already hold same data are skipped and program of others
+* 			is narrowed to span from first to last differing byte. This
+* 			saves write cycles and page endurance for mostly unchanged data.
 *
+* @note		Read back is done in page sized chunks, so stack usage is
+* 			bounded by "_25LCXXXX_CFG_PAGE_SIZE_BYTE".
 *
+* @param[in]	p_dev	- Pointer to device context
 * @param[in]	addr	- Start address of write
 * @param[in]	size	- Size of bytes to write
+* @param[in]	p_data	- Pointer to write data
 * @return 		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-_25lcxxxx_status_t _25lcxxxx_erase(const uint32_t addr, const uint32_t size)
+_25lcxxxx_status_t _25lcxxxx_dev_write_if_diff(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
 {
-	_25lcxxxx_status_t 	status		 	= e25LCXXXX_OK;
-	uint8_t				erase_data[32] 	= { 0 };
+	_25lcxxxx_status_t 		status				= e25LCXXXX_OK;
+	uint32_t				working_addr		= addr;
+	uint32_t				working_size		= size;
+	uint32_t				bytes_to_transfer	= 0UL;
+	uint32_t				data_offset			= 0UL;
+	uint32_t				diff_start			= 0UL;
+	uint32_t				diff_end			= 0UL;
+	uint8_t					page_buf[ _25LCXXXX_CFG_PAGE_SIZE_BYTE ];
+
+	_25LCXXXX_ASSERT( NULL != p_dev );
+
+	// Check for init
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
+
+	// Invalid inputs
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT(( addr + size - 1 ) <= p_dev->max_addr );
+
+	// Page must fit into compare buffer
+	_25LCXXXX_ASSERT( _25LCXXXX_DEV_PAGE_SIZE( p_dev ) <= _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+
+	_25lcxxxx_lock( p_dev );
 
-	_25LCXXXX_ASSERT( true == gb_is_init );
-	_25LCXXXX_ASSERT( size < 32 );
+	// Non-blocking write in progress
+	if ( e25LCXXXX_ASYNC_BUSY == p_dev->async.state )
+	{
+		_25lcxxxx_unlock( p_dev );
+		return e25LCXXXX_ERROR_BUSY;
+	}
 
-	// Prepare erase data
-	for ( uint8_t i = 0; i < 32; i++ )
+	while (( working_size > 0UL ) && ( e25LCXXXX_OK == status ))
 	{
-		erase_data[i] = _25LCXXX_ERASE_VALUE;
+		// Calculate bytes to transfer till end of page
+		bytes_to_transfer = _25lcxxxx_calc_transfer_size( p_dev, working_addr, working_size );
+
+		// Wait for previous write process
+		status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
+
+		// Read back current content
+		if ( e25LCXXXX_OK == status )
+		{
+			status = _25lcxxxx_read_command( p_dev, working_addr, page_buf, bytes_to_transfer );
+		}
+
+		if ( e25LCXXXX_OK == status )
+		{
+			// Find first & last differing byte
+			diff_start 	= 0UL;
+			diff_end	= bytes_to_transfer;
+
+			while (( diff_start < diff_end ) && ( page_buf[diff_start] == p_data[ data_offset + diff_start ] ))
+			{
+				diff_start++;
+			}
+			while (( diff_end > diff_start ) && ( page_buf[ diff_end - 1UL ] == p_data[ data_offset + diff_end - 1UL ] ))
+			{
+				diff_end--;
+			}
+
+			// Program only changed span
+			if ( diff_end > diff_start )
+			{
+				status = _25lcxxxx_program_page( p_dev, ( working_addr + diff_start ), ( diff_end - diff_start ), ( p_data + data_offset + diff_start ));
+			}
+
+			// Increment address & written data offset
+			data_offset += bytes_to_transfer;
+			working_addr += bytes_to_transfer;
+			working_size -= bytes_to_transfer;
+		}
 	}
 
-	// Erase memory
-	status = _25lcxxxx_write( addr, size, (uint8_t*) erase_data );
+	_25lcxxxx_unlock( p_dev );
 
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Read byte(s) from EEPROM
+*		Write scattered segments to EEPROM device instance
 *
-* @param[in]	addr	- Start address of write
-* @param[in]	size	- Size of bytes to write
-* @param[out]	p_data	- Pointer to read data
+* @brief	Segments are processed in order of addresses, page by page. All
+* 			segments falling into same page are merged into page image and
+* 			page is programmed only once, from first to last written byte.
+* 			Gaps between segments inside of that span are filled with
+* 			current content read back from device. So many small writes
+* 			(e.g. fields saved at shutdown) cost single page program per
+* 			affected page.
+*
+* @note		Segments can be given in any order. When they overlap, later
+* 			segment in array wins, same as with sequential writes.
+*
+* @param[in]	p_dev	- Pointer to device context
+* @param[in]	p_seg	- Pointer to segments
+* @param[in]	seg_cnt	- Number of segments
 * @return 		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-_25lcxxxx_status_t _25lcxxxx_read(const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+_25lcxxxx_status_t _25lcxxxx_dev_writev(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_seg_t * const p_seg, const uint32_t seg_cnt)
 {
-	_25lcxxxx_status_t 	status 		= e25LCXXXX_OK;
-	bool				wip_flag	= true;
+	_25lcxxxx_status_t 		status		= e25LCXXXX_OK;
+	uint32_t				page_addr	= 0UL;
+	uint32_t				from		= 0UL;
+	uint32_t				first		= 0UL;
+	uint32_t				last		= 0UL;
+	uint32_t				gap			= 0UL;
+	uint8_t					page_buf[ _25LCXXXX_CFG_PAGE_SIZE_BYTE ];
+	bool					is_set[ _25LCXXXX_CFG_PAGE_SIZE_BYTE ];
+
+	_25LCXXXX_ASSERT( NULL != p_dev );
 
 	// Check for init
-	_25LCXXXX_ASSERT( true == gb_is_init );
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
 
 	// Invalid inputs
-	_25LCXXXX_ASSERT( size > 0 );
-	_25LCXXXX_ASSERT(( addr + size - 1 ) <= _25LCXXXX_MAX_ADDR );
-
-	// Get WIP flag
-	// NOTE: Reading not possible when write in progress!
-	wip_flag = _25lcxxxx_read_wip_flag();
+	_25LCXXXX_ASSERT(( NULL != p_seg ) || ( 0UL == seg_cnt ));
 
-	// Check if write in progress
-	if ( false == wip_flag )
+	for ( uint32_t i = 0; i < seg_cnt; i++ )
 	{
-		// Send read command
-		status = _25lcxxxx_read_command( addr );
+		_25LCXXXX_ASSERT(( 0UL == p_seg[i].size ) || ( NULL != p_seg[i].p_data ));
+		_25LCXXXX_ASSERT(( 0UL == p_seg[i].size ) || (( p_seg[i].addr + p_seg[i].size - 1 ) <= p_dev->max_addr ));
+	}
+
+	// Page must fit into merge buffer
+	_25LCXXXX_ASSERT( _25LCXXXX_DEV_PAGE_SIZE( p_dev ) <= _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+
+	_25lcxxxx_lock( p_dev );
 
-		// Send data payload
-		status |= _25lcxxxx_if_receive( p_data, size, eSPI_CS_HIGH_ON_EXIT );
+	// Non-blocking write in progress
+	if ( e25LCXXXX_ASYNC_BUSY == p_dev->async.state )
+	{
+		_25lcxxxx_unlock( p_dev );
+		return e25LCXXXX_ERROR_BUSY;
 	}
-	else
+
+	// Lowest page with pending data
+	while (	( e25LCXXXX_OK == status )
+		&&	( true == _25lcxxxx_writev_next_page( p_dev, p_seg, seg_cnt, from, &page_addr )))
 	{
-		status = e25LCXXXX_ERROR;
+		// Merge all segments of page
+		memset( is_set, 0, _25LCXXXX_DEV_PAGE_SIZE( p_dev ));
+		_25lcxxxx_writev_merge( p_dev, p_seg, seg_cnt, page_addr, page_buf, is_set );
+
+		// Span from first to last written byte
+		first 	= 0UL;
+		last	= _25LCXXXX_DEV_PAGE_SIZE( p_dev ) - 1UL;
+
+		while ( false == is_set[first] )
+		{
+			first++;
+		}
+		while ( false == is_set[last] )
+		{
+			last--;
+		}
+
+		// Wait for previous write process
+		status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
+
+		// Fill gaps with current content
+		for ( uint32_t i = first; ( i <= last ) && ( e25LCXXXX_OK == status ); i += gap )
+		{
+			gap = 0UL;
+
+			while ( false == is_set[ i + gap ] )
+			{
+				gap++;
+			}
+
+			if ( gap > 0UL )
+			{
+				status = _25lcxxxx_read_command( p_dev, ( page_addr + i ), &page_buf[i], gap );
+			}
+			else
+			{
+				gap = 1UL;
+			}
+		}
+
+		if ( e25LCXXXX_OK == status )
+		{
+			status = _25lcxxxx_program_page( p_dev, ( page_addr + first ), ( last - first + 1UL ), &page_buf[first] );
+		}
+
+		from = page_addr + _25LCXXXX_DEV_PAGE_SIZE( p_dev );
 	}
 
+	_25lcxxxx_unlock( p_dev );
+
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Set protection
+*		Start non-blocking write of byte(s) to EEPROM device instance
 *
-* @pre	Chip WP pin must be set to low (0V) in order for protection to be
-* 		enabled in first place. If that condition is not fullfiled device
-* 		will not be write protected.
+* @brief	This function only queues write job and returns immediately. Job
+* 			is then advanced by "_25lcxxxx_dev_process()" one page at a time,
+* 			each time device finishes its internal write cycle. When all
+* 			pages are written optional callback is invoked with result.
 *
-* @param[in]	prot_opt	- Protection options
-* @return 		status 		- Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-_25lcxxxx_status_t _25lcxxxx_set_protection(const _25lcxxxx_protect_t prot_opt)
+* @note		Data pointed by p_data must stay valid until job is completed!
+*
+* @param[in]	p_dev	- Pointer to device context
+* @param[in]	addr	- Start address of write
+* @param[in]	size	- Size of bytes to write
+* @param[in]	p_data	- Pointer to write data
+* @param[in]	pf_done	- Completion callback, can be NULL
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_dev_write_async(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_25lcxxxx_async_cb_t pf_done)
 {
-	_25lcxxxx_status_t 		status 		= e25LCXXXX_OK;
-	_25lcxxxx_status_reg_t	stat_reg	= { .u = 0 };
+	_25lcxxxx_status_t 		status		= e25LCXXXX_OK;
+	pf_25lcxxxx_async_cb_t	pf_notify	= NULL;
+
+	_25LCXXXX_ASSERT( NULL != p_dev );
 
 	// Check for init
-	_25LCXXXX_ASSERT( true == gb_is_init );
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
+
+	// Invalid inputs
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT( NULL != p_data );
+	_25LCXXXX_ASSERT(( addr + size - 1 ) <= p_dev->max_addr );
+
+	_25lcxxxx_lock( p_dev );
+
+	// Only one job at a time
+	if ( e25LCXXXX_ASYNC_BUSY == p_dev->async.state )
+	{
+		status = e25LCXXXX_ERROR_BUSY;
+	}
+	else
+	{
+		// Queue job
+		p_dev->async.p_data 	= p_data;
+		p_dev->async.addr 		= addr;
+		p_dev->async.size 		= size;
+		p_dev->async.tick		= p_dev->cfg.p_if->pf_get_sys_time_ms();
+		p_dev->async.pf_done 	= pf_done;
+		p_dev->async.state		= e25LCXXXX_ASYNC_BUSY;
+
+		// Kick-off first page
+		status = _25lcxxxx_async_step( p_dev, &pf_notify );
+	}
 
-	// Set protection level
-	stat_reg.b.bp = prot_opt;
+	_25lcxxxx_unlock( p_dev );
 
-	// Write to device
-	status = _25lcxxxx_write_status( &stat_reg );
+	// Job failed right away
+	if ( NULL != pf_notify )
+	{
+		pf_notify( status );
+	}
 
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-* @} <!-- END GROUP -->
-*/
-////////////////////////////////////////////////////////////////////////////////
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*@addtogroup KERNEL_FUNCTIONS
-* @{ <!-- BEGIN GROUP -->
+*		Process non-blocking write of device instance
 *
-* 	Kernel functions of SPI EEPROM device 25LCxxxx/25AAxxxx
-*/
-////////////////////////////////////////////////////////////////////////////////
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Enable write latch
+* @brief	Shall be called periodically (e.g. from main loop). Each call
+* 			reads device status only once and programs next page when
+* 			device is no longer busy. It never blocks.
+*
+* 			Without pending job it puts device into deep power-down when
+* 			it was not accessed for "dpd_timeout_ms" (if enabled).
+*
+* @note		Completion callback is invoked after lock is released, so it
+* 			can start next job.
 *
+* @param[in]	p_dev	- Pointer to device context
 * @return 		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static _25lcxxxx_status_t _25lcxxxx_write_enable(void)
+_25lcxxxx_status_t _25lcxxxx_dev_process(_25lcxxxx_dev_t * const p_dev)
 {
-	_25lcxxxx_status_t 		status 	= e25LCXXXX_OK;
-	const _25lcxxxx_isa_t	cmd		= e25LCXXXX_ISA_WREN;
+	_25lcxxxx_status_t 		status		= e25LCXXXX_OK;
+	_25lcxxxx_status_reg_t	stat_reg	= { .u = 0 };
+	pf_25lcxxxx_async_cb_t	pf_notify	= NULL;
+
+	_25LCXXXX_ASSERT( NULL != p_dev );
+
+	// Check for init
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
+
+	_25lcxxxx_lock( p_dev );
+
+	if ( e25LCXXXX_ASYNC_BUSY == p_dev->async.state )
+	{
+		status = _25lcxxxx_async_step( p_dev, &pf_notify );
+	}
+
+	// Idle for too long - enter deep power-down
+	else if (	( p_dev->cfg.dpd_timeout_ms > 0UL )
+			&&	( false == p_dev->dpd.is_down )
+			&&	((uint32_t) ( p_dev->cfg.p_if->pf_get_sys_time_ms() - p_dev->dpd.last_access ) >= p_dev->cfg.dpd_timeout_ms ))
+	{
+		status = _25lcxxxx_read_status( p_dev, &stat_reg );
+
+		// Instruction is ignored during write cycle
+		if (	( e25LCXXXX_OK == status )
+			&&	( false == stat_reg.b.wip ))
+		{
+			status = _25lcxxxx_enter_power_down( p_dev );
+		}
+	}
+
+	_25lcxxxx_unlock( p_dev );
 
-	status = _25lcxxxx_if_transmit( &cmd, 1, ( eSPI_CS_HIGH_ON_EXIT | eSPI_CS_LOW_ON_ENTRY ));
+	// Notify user outside of lock
+	if ( NULL != pf_notify )
+	{
+		pf_notify( status );
+	}
 
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Disable write latch
+*		Get state of non-blocking write of device instance
 *
-* @return 		status 	- Status of operation
+* @param[in]	p_dev	- Pointer to device context
+* @return 		state 	- State of non-blocking write job
 */
 ////////////////////////////////////////////////////////////////////////////////
-static _25lcxxxx_status_t _25lcxxxx_write_disable(void)
+_25lcxxxx_async_state_t _25lcxxxx_dev_get_async_state(const _25lcxxxx_dev_t * const p_dev)
 {
-	_25lcxxxx_status_t 	status 	= e25LCXXXX_OK;
-	const _25lcxxxx_isa_t		cmd		= e25LCXXXX_ISA_WRDI;
-
-	status = _25lcxxxx_if_transmit( &cmd, 1, ( eSPI_CS_HIGH_ON_EXIT | eSPI_CS_LOW_ON_ENTRY ));
+	_25LCXXXX_ASSERT( NULL != p_dev );
 
-	return status;
+	return p_dev->async.state;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Read status register from device
+*		Wait for device instance to finish write cycle
 *
-* @param[out]	p_status_reg	- Pointer to status register
-* @return 		status 			- Status of operation
+* @note		Blocks for maximum of write cycle timeout.
+*
+* @param[in]	p_dev	- Pointer to device context
+* @return 		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static _25lcxxxx_status_t _25lcxxxx_read_status(_25lcxxxx_status_reg_t * const p_status_reg)
+_25lcxxxx_status_t _25lcxxxx_dev_wait_ready(_25lcxxxx_dev_t * const p_dev)
 {
-	_25lcxxxx_status_t 	status 	= e25LCXXXX_OK;
-	const _25lcxxxx_isa_t		cmd		= e25LCXXXX_ISA_RDST;
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	_25LCXXXX_ASSERT( NULL != p_dev );
+
+	// Check for init
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
 
-	status = _25lcxxxx_if_transmit( &cmd, 1, eSPI_CS_LOW_ON_ENTRY );
-	status |= _25lcxxxx_if_receive((uint8_t*) p_status_reg, 1, eSPI_CS_HIGH_ON_EXIT );
+	_25lcxxxx_lock( p_dev );
+	status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
+	_25lcxxxx_unlock( p_dev );
 
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Write to device status register
+*		Is device instance in write cycle
 *
-* @param[in]	p_status_reg	- Pointer to status register
-* @return 		status 			- Status of operation
+* @brief	Device is asked only when driver can not tell that write
+* 			cycle is over, otherwise no bus access is made. Function
+* 			does not wait.
+*
+* @param[in]	p_dev	- Pointer to device context
+* @return 		is_busy - Write cycle in progress
 */
 ////////////////////////////////////////////////////////////////////////////////
-static _25lcxxxx_status_t _25lcxxxx_write_status(const _25lcxxxx_status_reg_t * const p_status_reg)
+const bool _25lcxxxx_dev_is_busy(_25lcxxxx_dev_t * const p_dev)
 {
-	_25lcxxxx_status_t 		status 	= e25LCXXXX_OK;
-	const _25lcxxxx_isa_t	cmd		= e25LCXXXX_ISA_WDST;
+	bool is_busy = false;
 
-	status = _25lcxxxx_if_transmit( &cmd, 1, eSPI_CS_LOW_ON_ENTRY );
-	status |= _25lcxxxx_if_transmit((uint8_t*) p_status_reg, 1, eSPI_CS_HIGH_ON_EXIT );
+	_25LCXXXX_ASSERT( NULL != p_dev );
 
-	return status;
+	// Check for init
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
+
+	_25lcxxxx_lock( p_dev );
+
+	if ( false == _25lcxxxx_cycle_is_over( p_dev ))
+	{
+		is_busy = _25lcxxxx_read_wip_flag( p_dev );
+	}
+
+	_25lcxxxx_unlock( p_dev );
+
+	return is_busy;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Calculate number of sectors
-*
-*	This function calculates how many pages consumes area with a
-*	start of address and with a size of size argument. It is being
-*	used in write function.
+*		Get deep power-down statistics of device instance
 *
-* @param[in]	addr		- Start address of area
-* @param[in]	size		- Size of area
-* @return 		sector_num	- Number of sectors in that area
+* @param[in]	p_dev	- Pointer to device context
+* @param[out]	p_stats	- Pointer to statistics
+* @return 		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static uint32_t _25lcxxxx_calc_num_of_sectors(const uint32_t addr, const uint32_t size)
+_25lcxxxx_status_t _25lcxxxx_dev_get_dpd_stats(const _25lcxxxx_dev_t * const p_dev, _25lcxxxx_dpd_stats_t * const p_stats)
 {
-	uint32_t sector_num = 0UL;
-	uint32_t k_a 		= 0UL;
-	uint32_t k_s		= 0UL;
-
-	// Calculate address & size factors of sector size
-	k_a = (uint32_t) ( addr / _25LCXXXX_CFG_PAGE_SIZE_BYTE );
-	k_s = (uint32_t) (( addr + size - 1UL ) / _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+	_25LCXXXX_ASSERT( NULL != p_dev );
+	_25LCXXXX_ASSERT( NULL != p_stats );
 
-	// Based on address & size factors number of sectors can be calculated
-	sector_num = ( k_s - k_a ) + 1UL;
+	*p_stats = p_dev->dpd.stats;
 
-	return sector_num;
+	return e25LCXXXX_OK;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Calculate transfer size of data in bytes
+*		Get geometry of device instance
 *
-*	This function caclulated based on address and size how many bytes are
-*	in current page. In other words what amount of bytes can be written until
-*	page boundary is hit. It is being used for write function.
+* @note		Useful when geometry is detected at initialization.
 *
-* @param[in]	addr	- Start address
-* @param[in]	size	- Size of bytes
-* @return 		status 	- Status of operation
+* @param[in]	p_dev		- Pointer to device context
+* @param[out]	p_size		- Size of memory array in bytes, can be NULL
+* @param[out]	p_page_size	- Page size in bytes, can be NULL
+* @return 		status 		- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static uint32_t _25lcxxxx_calc_transfer_size(const uint32_t addr, const uint32_t size)
+_25lcxxxx_status_t _25lcxxxx_dev_get_geometry(const _25lcxxxx_dev_t * const p_dev, uint32_t * const p_size, uint16_t * const p_page_size)
 {
-	uint32_t bytes_to_transfer 	= 0UL;
-	uint32_t bytes_in_sector 	= 0UL;
-
-	// Calculate how many bytes till page boundary
-	bytes_in_sector = _25LCXXXX_CFG_PAGE_SIZE_BYTE - ( addr % _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+	_25LCXXXX_ASSERT( NULL != p_dev );
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
 
-	// Bytes will not pass page boundary
-	if ( size <= bytes_in_sector )
+	if ( NULL != p_size )
 	{
-		bytes_to_transfer = size;
+		*p_size = p_dev->max_addr + 1UL;
 	}
 
-	// Bytes will pass page boundary - limit to boundary
-	else
+	if ( NULL != p_page_size )
 	{
-		bytes_to_transfer = bytes_in_sector;
+		*p_page_size = _25LCXXXX_DEV_PAGE_SIZE( p_dev );
 	}
 
-	return bytes_to_transfer;
+	return e25LCXXXX_OK;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Assemble read/write command
+*		Get write cycle time statistics of device instance
 *
-* @note For know this function has been tested only on 25LC640 device!
+* @note		Write cycle time is learned only with microsecond time
+* 			interface, otherwise expected time from configuration is
+* 			reported.
 *
-* @param[out]	p_frame		- Pointer to cmd frame
-* @param[in]	rw_cmd		- Device command for read or write
-* @param[in]	addr		- Start address of read or write
-* @return 		void
+* @param[in]	p_dev	- Pointer to device context
+* @param[out]	p_stats	- Pointer to statistics
+* @return 		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static void _25lcxxxx_assemble_rw_cmd(_25lcxxxx_rw_cmd_t * const p_frame, const _25lcxxxx_isa_t rw_cmd, const uint32_t addr)
+_25lcxxxx_status_t _25lcxxxx_dev_get_twc_stats(const _25lcxxxx_dev_t * const p_dev, _25lcxxxx_twc_stats_t * const p_stats)
 {
-	_25LCXXXX_ASSERT( NULL != p_frame );
+	_25LCXXXX_ASSERT( NULL != p_dev );
+	_25LCXXXX_ASSERT( NULL != p_stats );
 
-	p_frame->u 				= 0UL;
-	p_frame->field.cmd 		= rw_cmd;
+	*p_stats = p_dev->cycle.stats;
 
-	#if ( _25LCXXXX_CFG_ADDR_BIT_NUM < 10 )
-		p_frame->field.addr[0]	= ( addr 			& 0xFFU );
+	return e25LCXXXX_OK;
+}
 
-	#elif ( _25LCXXXX_CFG_ADDR_BIT_NUM < 16 )
-		p_frame->field.addr[0]	= (( addr >> 8U ) 	& 0xFFU );
-		p_frame->field.addr[1]	= ( addr 			& 0xFFU );
-	#else
-		p_frame->field.addr[0]	= (( addr >> 16U ) 	& 0xFFU );
-		p_frame->field.addr[1]	= (( addr >> 8U ) 	& 0xFFU );
-		p_frame->field.addr[2]	= ( addr 			& 0xFFU );
+#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get performance statistics of device instance
+	*
+	* @note		Wear map splits memory array into "_25LCXXXX_CFG_STATS_WEAR_BIN_NUM"
+	* 			groups of equal number of pages and counts program & erase
+	* 			cycles of each group.
+	*
+	* @param[in]	p_dev	- Pointer to device context
+	* @param[out]	p_stats	- Pointer to statistics
+	* @return 		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	_25lcxxxx_status_t _25lcxxxx_dev_get_stats(const _25lcxxxx_dev_t * const p_dev, _25lcxxxx_stats_t * const p_stats)
+	{
+		_25LCXXXX_ASSERT( NULL != p_dev );
+		_25LCXXXX_ASSERT( NULL != p_stats );
 
-	#endif
-}
+		*p_stats = p_dev->stats;
+
+		return e25LCXXXX_OK;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Reset performance statistics of device instance
+	*
+	* @param[in]	p_dev	- Pointer to device context
+	* @return 		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	_25lcxxxx_status_t _25lcxxxx_dev_reset_stats(_25lcxxxx_dev_t * const p_dev)
+	{
+		_25LCXXXX_ASSERT( NULL != p_dev );
+
+		memset( &p_dev->stats, 0, sizeof( p_dev->stats ));
+
+		return e25LCXXXX_OK;
+	}
+
+#endif
+
+#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get read cache statistics of device instance
+	*
+	* @note		Hit ratio is hit_cnt / ( hit_cnt + miss_cnt ).
+	*
+	* @param[in]	p_dev	- Pointer to device context
+	* @param[out]	p_stats	- Pointer to statistics
+	* @return 		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	_25lcxxxx_status_t _25lcxxxx_dev_get_cache_stats(const _25lcxxxx_dev_t * const p_dev, _25lcxxxx_cache_stats_t * const p_stats)
+	{
+		_25LCXXXX_ASSERT( NULL != p_dev );
+		_25LCXXXX_ASSERT( NULL != p_stats );
+
+		*p_stats = p_dev->cache.stats;
+
+		return e25LCXXXX_OK;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Reset read cache statistics of device instance
+	*
+	* @param[in]	p_dev	- Pointer to device context
+	* @return 		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	_25lcxxxx_status_t _25lcxxxx_dev_reset_cache_stats(_25lcxxxx_dev_t * const p_dev)
+	{
+		_25LCXXXX_ASSERT( NULL != p_dev );
+
+		memset( &p_dev->cache.stats, 0, sizeof( p_dev->cache.stats ));
+
+		return e25LCXXXX_OK;
+	}
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Send write command to device
+*		Erase byte(s) from EEPROM device instance
 *
-*	This function first check if writing to device is allowed by looking into
-*	Write-In-Progress (WIP) flag in status register. Only when this flag is
-*	cleared in less that "_25LCXXXX_WAIT_WRITE_TIMEOUT_MS" command for
-*	write is being send.
+* @brief	This function erase number of bytes from eeprom device starting
+* 			from addr parameter. Erase value is defined by "_25LCXXX_ERASE_VALUE"
+* 			macro.
 *
-* @param[in]	addr		- Start address of write transfer
-* @return 		status 		- Status of operation
+* 			On devices with extended instruction set whole array is erased
+* 			with chip erase, aligned sectors with sector erase and aligned
+* 			pages with page erase. Unaligned edges and devices without
+* 			erase instructions are programmed with erase value page by page.
+*
+* @note		Function blocks until erase is completed.
+*
+* @param[in]	p_dev	- Pointer to device context
+* @param[in]	addr	- Start address of erase
+* @param[in]	size	- Size of bytes to erase
+* @return 		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static _25lcxxxx_status_t _25lcxxxx_write_command(const uint32_t addr)
+_25lcxxxx_status_t _25lcxxxx_dev_erase(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size)
 {
-	_25lcxxxx_status_t 	status 	= e25LCXXXX_OK;
-	_25lcxxxx_rw_cmd_t	cmd		= { .u = 0 };
+	_25lcxxxx_status_t 	status		 		= e25LCXXXX_OK;
+	uint32_t			working_addr		= addr;
+	uint32_t			working_size		= size;
+	uint32_t			bytes_to_transfer	= 0UL;
 
-	// Wait for previous write process
-	status = _25lcxxxx_wait_for_write_process( _25LCXXXX_WAIT_WRITE_TIMEOUT_MS );
+	_25LCXXXX_ASSERT( NULL != p_dev );
 
-	if ( e25LCXXXX_OK == status )
-	{
-		// Enable write enable latch
-		_25lcxxxx_write_enable();
+	// Check for init
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
+
+	// Invalid inputs
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT(( addr + size - 1 ) <= p_dev->max_addr );
 
-		// Assemble command
-		_25lcxxxx_assemble_rw_cmd( &cmd, e25LCXXXX_ISA_WRITE, addr );
+	// Blank page must cover device page
+	_25LCXXXX_ASSERT( _25LCXXXX_DEV_PAGE_SIZE( p_dev ) <= sizeof( g_25lcxxxx_blank_page ));
 
-		// Send command
-		// NOTE: Based on number of address bits command is being divided!
-		#if ( _25LCXXXX_CFG_ADDR_BIT_NUM <= 8)
-			status = _25lcxxxx_if_transmit((uint8_t*) &cmd.u, 2, eSPI_CS_LOW_ON_ENTRY );
+	_25lcxxxx_lock( p_dev );
 
-		#elif ( 9 == _25LCXXXX_CFG_ADDR_BIT_NUM )
+	// Non-blocking write in progress
+	if ( e25LCXXXX_ASYNC_BUSY == p_dev->async.state )
+	{
+		_25lcxxxx_unlock( p_dev );
+		return e25LCXXXX_ERROR_BUSY;
+	}
+
+	const uint32_t sector_size = ( p_dev->max_addr + 1UL ) / _25LCXXXX_SECTOR_NUM;
+
+	while (( working_size > 0UL ) && ( e25LCXXXX_OK == status ))
+	{
+		// Wait for previous write/erase process
+		status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_ERASE_TIMEOUT_MS );
 
-			// 9 bit address specialty
-			if (( addr & 0x100U ) == 0x100U )
+		if ( e25LCXXXX_OK == status )
+		{
+			// Whole array
+			if (	( _25LCXXXX_DEV_HAS_FEAT( p_dev, _25LCXXXX_PART_FEAT_CE ))
+				&&	( 0UL == working_addr )
+				&&	( working_size > p_dev->max_addr ))
 			{
-				cmd.field.cmd |= ( 0x80U );
+				status = _25lcxxxx_erase_command( p_dev, e25LCXXXX_ISA_CE, 0UL );
+				bytes_to_transfer = working_size;
 			}
-			else
+
+			// Aligned sector
+			else if (	( _25LCXXXX_DEV_HAS_FEAT( p_dev, _25LCXXXX_PART_FEAT_SE ))
+					&&	( 0UL == ( working_addr & ( sector_size - 1UL )))
+					&&	( working_size >= sector_size ))
 			{
-				cmd.field.cmd &= ~( 0x80U );
+				status = _25lcxxxx_erase_command( p_dev, e25LCXXXX_ISA_SE, working_addr );
+				bytes_to_transfer = sector_size;
 			}
 
-			status = _25lcxxxx_if_transmit((uint8_t*) &cmd.u, 2, eSPI_CS_LOW_ON_ENTRY );
+			// Aligned page
+			else if (	( _25LCXXXX_DEV_HAS_FEAT( p_dev, _25LCXXXX_PART_FEAT_PE ))
+					&&	( 0UL == ( working_addr & _25LCXXXX_DEV_PAGE_MASK( p_dev )))
+					&&	( working_size >= _25LCXXXX_DEV_PAGE_SIZE( p_dev )))
+			{
+				status = _25lcxxxx_erase_command( p_dev, e25LCXXXX_ISA_PE, working_addr );
+				bytes_to_transfer = _25LCXXXX_DEV_PAGE_SIZE( p_dev );
+			}
 
-		#elif ( _25LCXXXX_CFG_ADDR_BIT_NUM <= 16 )
-			status = _25lcxxxx_if_transmit((uint8_t*) &cmd.u, 3, eSPI_CS_LOW_ON_ENTRY );
+			// Program erase value till end of page
+			else
+			{
+				bytes_to_transfer = _25lcxxxx_calc_transfer_size( p_dev, working_addr, working_size );
+				status = _25lcxxxx_program_page( p_dev, working_addr, bytes_to_transfer, g_25lcxxxx_blank_page );
+			}
 
-		#elif ( _25LCXXXX_CFG_ADDR_BIT_NUM <= 24 )
-			status = _25lcxxxx_if_transmit((uint8_t*) &cmd.u, 4, eSPI_CS_LOW_ON_ENTRY );
+			working_addr += bytes_to_transfer;
+			working_size -= bytes_to_transfer;
+		}
+	}
 
-		#endif
+	// Erase takes longer than write, wait here so that following
+	// operations are not timed out
+	if ( e25LCXXXX_OK == status )
+	{
+		status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_ERASE_TIMEOUT_MS );
 	}
 
+	_25lcxxxx_unlock( p_dev );
+
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Send read command to device
+*		Read byte(s) from EEPROM device instance
 *
-* 	@note	Before reading from device it is important to check for
-* 			Write-In-Progress (WIP) flag in status register.
+* @brief	When read is completely inside of last programmed data (and
+* 			"_25LCXXXX_CFG_READ_FWD_EN" is enabled) while its write cycle
+* 			is still in progress, it is served from RAM copy without
+* 			accessing device. Otherwise function waits for write cycle
+* 			to complete and then reads device.
 *
-* @param[in]	addr		- Start address of write transfer
-* @return 		status 		- Status of operation
+* @param[in]	p_dev	- Pointer to device context
+* @param[in]	addr	- Start address of read
+* @param[in]	size	- Size of bytes to read
+* @param[out]	p_data	- Pointer to read data
+* @return 		status 	- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static _25lcxxxx_status_t _25lcxxxx_read_command(const uint32_t addr)
+_25lcxxxx_status_t _25lcxxxx_dev_read(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
 {
-	_25lcxxxx_status_t 		status 	= e25LCXXXX_OK;
-	_25lcxxxx_rw_cmd_t		cmd		= { .u = 0 };
+	_25lcxxxx_status_t 	status 		= e25LCXXXX_OK;
 
-	// Assemble command
-	_25lcxxxx_assemble_rw_cmd( &cmd, e25LCXXXX_ISA_READ, addr );
+	_25LCXXXX_ASSERT( NULL != p_dev );
 
-	// Send command
-	// NOTE: Based on number of address bits command is being divided!
-	#if ( _25LCXXXX_CFG_ADDR_BIT_NUM <= 8)
-		status = _25lcxxxx_if_transmit((uint8_t*) &cmd.u, 2, eSPI_CS_LOW_ON_ENTRY );
+	// Check for init
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
 
-	#elif ( 9 == _25LCXXXX_CFG_ADDR_BIT_NUM )
+	// Invalid inputs
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT(( addr + size - 1 ) <= p_dev->max_addr );
 
-		// 9 bit address specialty
-		if (( addr & 0x100U ) == 0x100U )
-		{
-			cmd.field.cmd |= ( 0x80U );
-		}
-		else
+	_25lcxxxx_lock( p_dev );
+
+	_25LCXXXX_STATS_ADD( p_dev, read_cnt, 1UL );
+
+	#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN )
+
+		// Forward just programmed data
+		if (	( true == p_dev->cycle.is_active )
+			&&	( p_dev->fwd.size > 0UL )
+			&&	( addr >= p_dev->fwd.addr )
+			&&	(( addr + size ) <= ( p_dev->fwd.addr + p_dev->fwd.size )))
 		{
-			cmd.field.cmd &= ~( 0x80U );
+			memcpy( p_data, &p_dev->fwd.data[ addr - p_dev->fwd.addr ], size );
+			_25LCXXXX_STATS_ADD( p_dev, fwd_cnt, 1UL );
+
+			_25lcxxxx_unlock( p_dev );
+			return e25LCXXXX_OK;
 		}
 
-		status = _25lcxxxx_if_transmit((uint8_t*) &cmd.u, 2, eSPI_CS_LOW_ON_ENTRY );
+	#endif
+
+	#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+
+		// Device is accessed only for pages not in cache
+		status = _25lcxxxx_cache_read( p_dev, addr, size, p_data );
+
+	#else
 
-	#elif ( _25LCXXXX_CFG_ADDR_BIT_NUM <= 16 )
-		status = _25lcxxxx_if_transmit((uint8_t*) &cmd.u, 3, eSPI_CS_LOW_ON_ENTRY );
+		// Wait for write process
+		// NOTE: Reading not possible when write in progress!
+		status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
 
-	#elif ( _25LCXXXX_CFG_ADDR_BIT_NUM <= 24 )
-		status = _25lcxxxx_if_transmit((uint8_t*) &cmd.u, 4, eSPI_CS_LOW_ON_ENTRY );
+		if ( e25LCXXXX_OK == status )
+		{
+			// Send read command & receive data payload
+			status = _25lcxxxx_read_command( p_dev, addr, p_data, size );
+		}
 
 	#endif
 
+	_25lcxxxx_unlock( p_dev );
+
 	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Read WIP flag from device
+*		Streaming read of EEPROM device instance into consumer
+*
+* @brief	Single read command is sent and data is then clocked out in
+* 			chunks of "_25LCXXXX_CFG_READ_CHUNK_SIZE" while chip select
+* 			stays asserted. Each received chunk is passed to consumer.
+* 			Chunks alternate between two buffers, thus chunk passed to
+* 			consumer stays intact while following chunk is received and
+* 			can be handed over (e.g. to UART DMA) as long as it is
+* 			released before next consumer call returns. Last chunk must
+* 			be released before consumer returns.
+*
+* @note		Consumer is called with device locked and chip select
+* 			asserted, it must not access same device or SPI bus!
 *
-* @return 		wip - State of Write-In-Progress
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	addr		- Start address of read
+* @param[in]	size		- Size of bytes to read
+* @param[in]	pf_consumer	- Chunk consumer
+* @return 		status 		- Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-static bool _25lcxxxx_read_wip_flag(void)
+_25lcxxxx_status_t _25lcxxxx_dev_read_stream(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, pf_25lcxxxx_read_cb_t pf_consumer)
 {
-	bool 					wip 		= false;
-	_25lcxxxx_status_reg_t	stat_reg	= { .u = 0 };
+	_25lcxxxx_status_t 	status 		= e25LCXXXX_OK;
+	_25lcxxxx_rw_cmd_t	cmd			= { .u = 0 };
+	uint8_t				chunk[2][_25LCXXXX_CFG_READ_CHUNK_SIZE];
+	uint32_t			offset		= 0UL;
+	uint32_t			chunk_cnt	= 0UL;
 
-	if ( e25LCXXXX_OK == _25lcxxxx_read_status( & stat_reg ))
-	{
-		wip = (bool) ( stat_reg.b.wip );
-	}
+	_25LCXXXX_ASSERT( NULL != p_dev );
 
-	return wip;
-}
+	// Check for init
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*		Read WEL flag from device
-*
-* @return 		wel - State of Write-Enable-Latch
-*/
-////////////////////////////////////////////////////////////////////////////////
-static bool _25lcxxxx_read_wel_flag(void)
-{
-	bool wel = false;
-	_25lcxxxx_status_reg_t	stat_reg	= { .u = 0 };
+	// Invalid inputs
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT(( addr + size - 1 ) <= p_dev->max_addr );
+	_25LCXXXX_ASSERT( NULL != pf_consumer );
 
-	if ( e25LCXXXX_OK == _25lcxxxx_read_status( & stat_reg ))
-	{
-		wel = (bool) ( stat_reg.b.wel );
-	}
+	_25lcxxxx_lock( p_dev );
+
+	_25LCXXXX_STATS_ADD( p_dev, read_cnt, 1UL );
+
+	// Wait for write process
+	// NOTE: Reading not possible when write in progress!
+	status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
+
+	// Device sleeps - wake it up first
+	if (	( e25LCXXXX_OK == status )
+		&&	( true == p_dev->dpd.is_down ))
+	{
+		status = _25lcxxxx_wake_up( p_dev );
+	}
+
+	if ( e25LCXXXX_OK == status )
+	{
+		// Assemble & send command
+		_25lcxxxx_assemble_rw_cmd( p_dev, &cmd, e25LCXXXX_ISA_READ, addr );
+		status = p_dev->cfg.p_if->pf_transmit((uint8_t*) &cmd.u, _25LCXXXX_DEV_CMD_SIZE( p_dev ), eSPI_CS_LOW_ON_ENTRY );
+
+		// Clock out data chunk by chunk
+		while (( offset < size ) && ( e25LCXXXX_OK == status ))
+		{
+			uint8_t * const	p_chunk		= chunk[ chunk_cnt & 1UL ];
+			const uint32_t	chunk_size	= (( size - offset ) > _25LCXXXX_CFG_READ_CHUNK_SIZE ) ? _25LCXXXX_CFG_READ_CHUNK_SIZE : ( size - offset );
+
+			offset += chunk_size;
+			chunk_cnt++;
+
+			status = p_dev->cfg.p_if->pf_receive( p_chunk, chunk_size, (( offset < size ) ? eSPI_CS_NONE : eSPI_CS_HIGH_ON_EXIT ));
+
+			if ( e25LCXXXX_OK == status )
+			{
+				pf_consumer( p_chunk, chunk_size );
+			}
+		}
+
+		// Failed command or chunk - end transaction anyway
+		if ( e25LCXXXX_OK != status )
+		{
+			(void) p_dev->cfg.p_if->pf_receive( chunk[0], 1UL, eSPI_CS_HIGH_ON_EXIT );
+		}
+
+		// Restart idle time
+		if ( p_dev->cfg.dpd_timeout_ms > 0UL )
+		{
+			p_dev->dpd.last_access = p_dev->cfg.p_if->pf_get_sys_time_ms();
+		}
+
+		_25LCXXXX_STATS_ADD( p_dev, cs_cnt, 1UL );
+		_25LCXXXX_STATS_ADD( p_dev, xfer_cnt, ( 1UL + chunk_cnt ));
+		_25LCXXXX_STATS_ADD( p_dev, tx_bytes, _25LCXXXX_DEV_CMD_SIZE( p_dev ));
+		_25LCXXXX_STATS_ADD( p_dev, rx_bytes, offset );
+	}
+
+	_25lcxxxx_unlock( p_dev );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set protection of device instance
+*
+* @pre	Chip WP pin must be set to low (0V) in order for protection to be
+* 		enabled in first place. If that condition is not fullfiled device
+* 		will not be write protected.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	prot_opt	- Protection options
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_dev_set_protection(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_protect_t prot_opt)
+{
+	_25lcxxxx_status_t 		status 		= e25LCXXXX_OK;
+	_25lcxxxx_status_reg_t	stat_reg	= { .u = 0 };
+
+	_25LCXXXX_ASSERT( NULL != p_dev );
+
+	// Check for init
+	_25LCXXXX_ASSERT( true == p_dev->is_init );
+
+	_25lcxxxx_lock( p_dev );
+
+	// Non-blocking write in progress
+	if ( e25LCXXXX_ASYNC_BUSY == p_dev->async.state )
+	{
+		status = e25LCXXXX_ERROR_BUSY;
+	}
+	else
+	{
+		// Set protection level
+		stat_reg.b.bp = prot_opt;
+
+		// Status register can not be written during write cycle
+		status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
+
+		if ( e25LCXXXX_OK == status )
+		{
+			// Write to device
+			status = _25lcxxxx_write_status( p_dev, &stat_reg );
+		}
+
+		// Unknown outcome - treat whole array as protected
+		if ( e25LCXXXX_OK == status )
+		{
+			p_dev->prot = prot_opt;
+		}
+		else
+		{
+			p_dev->prot = e25LCXXXX_PROTECT_UPPER_ALL;
+		}
+
+		#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN )
+
+			// Protected data might not be programmed
+			p_dev->fwd.size = 0UL;
+
+		#endif
+	}
+
+	_25lcxxxx_unlock( p_dev );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get default device instance
+*
+* @note		Default device is configured by "_25lcxxxx_cfg.h" and uses
+* 			"_25lcxxxx_if_*" interface functions. It can be used with all
+* 			"_25lcxxxx_dev_*" functions.
+*
+* @return 		p_dev - Pointer to default device context
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_dev_t * _25lcxxxx_get_dev(void)
+{
+	return &g_25lcxxxx_dev;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize EEPROM device
+*
+* @return 	status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_init(void)
+{
+	return _25lcxxxx_dev_init( &g_25lcxxxx_dev, &g_25lcxxxx_dev_cfg );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		De-Initialize EEPROM device
+*
+* @return 	status - Status of deinitialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_deinit	(void)
+{
+	return _25lcxxxx_dev_deinit( &g_25lcxxxx_dev );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Is device initialized
+*
+* @return 	is_init - Initialization flag of default device
+*/
+////////////////////////////////////////////////////////////////////////////////
+const bool _25lcxxxx_is_init(void)
+{
+	return (const bool) g_25lcxxxx_dev.is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write byte(s) to EEPROM
+*
+* @note		Need to be check for page boundary unless it wrap around!
+*
+* @param[in]	addr	- Start address of write
+* @param[in]	size	- Size of bytes to write
+* @param[in]	p_data	- Pointer to write data
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_write(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	return _25lcxxxx_dev_write( &g_25lcxxxx_dev, addr, size, p_data );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write only changed byte(s) to EEPROM
+*
+* @param[in]	addr	- Start address of write
+* @param[in]	size	- Size of bytes to write
+* @param[in]	p_data	- Pointer to write data
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_write_if_diff(const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	return _25lcxxxx_dev_write_if_diff( &g_25lcxxxx_dev, addr, size, p_data );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write scattered segments to EEPROM
+*
+* @param[in]	p_seg	- Pointer to segments
+* @param[in]	seg_cnt	- Number of segments
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_writev(const _25lcxxxx_seg_t * const p_seg, const uint32_t seg_cnt)
+{
+	return _25lcxxxx_dev_writev( &g_25lcxxxx_dev, p_seg, seg_cnt );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Start non-blocking write of byte(s) to EEPROM
+*
+* @note		Data pointed by p_data must stay valid until job is completed!
+*
+* @param[in]	addr	- Start address of write
+* @param[in]	size	- Size of bytes to write
+* @param[in]	p_data	- Pointer to write data
+* @param[in]	pf_done	- Completion callback, can be NULL
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_write_async(const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_25lcxxxx_async_cb_t pf_done)
+{
+	return _25lcxxxx_dev_write_async( &g_25lcxxxx_dev, addr, size, p_data, pf_done );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Process non-blocking write
+*
+* @brief	Shall be called periodically (e.g. from main loop). It never
+* 			blocks.
+*
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_process(void)
+{
+	return _25lcxxxx_dev_process( &g_25lcxxxx_dev );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get state of non-blocking write
+*
+* @return 		state - State of non-blocking write job
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_async_state_t _25lcxxxx_get_async_state(void)
+{
+	return g_25lcxxxx_dev.async.state;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait for device to finish write cycle
+*
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_wait_ready(void)
+{
+	return _25lcxxxx_dev_wait_ready( &g_25lcxxxx_dev );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Is device in write cycle
+*
+* @return 		is_busy - Write cycle in progress
+*/
+////////////////////////////////////////////////////////////////////////////////
+const bool _25lcxxxx_is_busy(void)
+{
+	return _25lcxxxx_dev_is_busy( &g_25lcxxxx_dev );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get deep power-down statistics
+*
+* @param[out]	p_stats	- Pointer to statistics
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_get_dpd_stats(_25lcxxxx_dpd_stats_t * const p_stats)
+{
+	return _25lcxxxx_dev_get_dpd_stats( &g_25lcxxxx_dev, p_stats );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get geometry of device
+*
+* @param[out]	p_size		- Size of memory array in bytes, can be NULL
+* @param[out]	p_page_size	- Page size in bytes, can be NULL
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_get_geometry(uint32_t * const p_size, uint16_t * const p_page_size)
+{
+	return _25lcxxxx_dev_get_geometry( &g_25lcxxxx_dev, p_size, p_page_size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get write cycle time statistics of device
+*
+* @param[out]	p_stats	- Pointer to statistics
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_get_twc_stats(_25lcxxxx_twc_stats_t * const p_stats)
+{
+	return _25lcxxxx_dev_get_twc_stats( &g_25lcxxxx_dev, p_stats );
+}
+
+#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get performance statistics of device
+	*
+	* @param[out]	p_stats	- Pointer to statistics
+	* @return 		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	_25lcxxxx_status_t _25lcxxxx_get_stats(_25lcxxxx_stats_t * const p_stats)
+	{
+		return _25lcxxxx_dev_get_stats( &g_25lcxxxx_dev, p_stats );
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Reset performance statistics of device
+	*
+	* @return 		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	_25lcxxxx_status_t _25lcxxxx_reset_stats(void)
+	{
+		return _25lcxxxx_dev_reset_stats( &g_25lcxxxx_dev );
+	}
+
+#endif
+
+#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Get read cache statistics of device
+	*
+	* @param[out]	p_stats	- Pointer to statistics
+	* @return 		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	_25lcxxxx_status_t _25lcxxxx_get_cache_stats(_25lcxxxx_cache_stats_t * const p_stats)
+	{
+		return _25lcxxxx_dev_get_cache_stats( &g_25lcxxxx_dev, p_stats );
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Reset read cache statistics of device
+	*
+	* @return 		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	_25lcxxxx_status_t _25lcxxxx_reset_cache_stats(void)
+	{
+		return _25lcxxxx_dev_reset_cache_stats( &g_25lcxxxx_dev );
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Erase byte(s) from EEPROM
+*
+* @param[in]	addr	- Start address of write
+* @param[in]	size	- Size of bytes to write
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_erase(const uint32_t addr, const uint32_t size)
+{
+	return _25lcxxxx_dev_erase( &g_25lcxxxx_dev, addr, size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read byte(s) from EEPROM
+*
+* @param[in]	addr	- Start address of write
+* @param[in]	size	- Size of bytes to write
+* @param[out]	p_data	- Pointer to read data
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_read(const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+	return _25lcxxxx_dev_read( &g_25lcxxxx_dev, addr, size, p_data );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Streaming read of EEPROM into consumer
+*
+* @param[in]	addr		- Start address of read
+* @param[in]	size		- Size of bytes to read
+* @param[in]	pf_consumer	- Chunk consumer
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_read_stream(const uint32_t addr, const uint32_t size, pf_25lcxxxx_read_cb_t pf_consumer)
+{
+	return _25lcxxxx_dev_read_stream( &g_25lcxxxx_dev, addr, size, pf_consumer );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set protection
+*
+* @pre	Chip WP pin must be set to low (0V) in order for protection to be
+* 		enabled in first place. If that condition is not fullfiled device
+* 		will not be write protected.
+*
+* @param[in]	prot_opt	- Protection options
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_set_protection(const _25lcxxxx_protect_t prot_opt)
+{
+	return _25lcxxxx_dev_set_protection( &g_25lcxxxx_dev, prot_opt );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup KERNEL_FUNCTIONS
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Kernel functions of SPI EEPROM device 25LCxxxx/25AAxxxx
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Transfer command with optional data payload
+*
+*	Complete bus transaction is framed by single chip select assertion. When
+*	device interface provides vectored transfer command and payload are
+*	passed in one call, otherwise command is sent first and payload follows
+*	in second call.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	p_cmd		- Pointer to command (opcode & address)
+* @param[in]	cmd_size	- Size of command
+* @param[in]	p_tx		- Pointer to transmit payload, NULL if none
+* @param[out]	p_rx		- Pointer to receive payload, NULL if none
+* @param[in]	size		- Size of payload
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_transfer(_25lcxxxx_dev_t * const p_dev, const uint8_t * const p_cmd, const uint32_t cmd_size, const uint8_t * const p_tx, uint8_t * const p_rx, const uint32_t size)
+{
+	_25lcxxxx_status_t 				status 	= e25LCXXXX_OK;
+	const _25lcxxxx_if_t * const	p_if	= p_dev->cfg.p_if;
+
+	// Device sleeps - wake it up first
+	if ( true == p_dev->dpd.is_down )
+	{
+		status = _25lcxxxx_wake_up( p_dev );
+	}
+
+	if ( e25LCXXXX_OK != status )
+	{
+		// Device not accessible
+	}
+	else if ( NULL != p_if->pf_transmitv )
+	{
+		const _25lcxxxx_iovec_t iov[2] =
+		{
+			{ .p_tx = p_cmd, 	.p_rx = NULL, 	.size = cmd_size 	},
+			{ .p_tx = p_tx, 	.p_rx = p_rx, 	.size = size 		},
+		};
+
+		status = p_if->pf_transmitv( iov, (( size > 0UL ) ? 2UL : 1UL ), ( eSPI_CS_LOW_ON_ENTRY | eSPI_CS_HIGH_ON_EXIT ));
+	}
+
+	// Command only
+	else if ( 0UL == size )
+	{
+		status = p_if->pf_transmit( p_cmd, cmd_size, ( eSPI_CS_LOW_ON_ENTRY | eSPI_CS_HIGH_ON_EXIT ));
+	}
+	else
+	{
+		status = p_if->pf_transmit( p_cmd, cmd_size, eSPI_CS_LOW_ON_ENTRY );
+
+		if ( NULL != p_tx )
+		{
+			status |= p_if->pf_transmit( p_tx, size, eSPI_CS_HIGH_ON_EXIT );
+		}
+		else
+		{
+			status |= p_if->pf_receive( p_rx, size, eSPI_CS_HIGH_ON_EXIT );
+		}
+	}
+
+	// Restart idle time
+	if ( p_dev->cfg.dpd_timeout_ms > 0UL )
+	{
+		p_dev->dpd.last_access = p_if->pf_get_sys_time_ms();
+	}
+
+	// Command might have been taken - device must be asked again
+	if ( e25LCXXXX_OK != status )
+	{
+		p_dev->cycle.is_known = false;
+	}
+
+	_25LCXXXX_STATS_ADD( p_dev, cs_cnt, 1UL );
+	_25LCXXXX_STATS_ADD( p_dev, xfer_cnt, ((( NULL != p_if->pf_transmitv ) || ( 0UL == size )) ? 1UL : 2UL ));
+	_25LCXXXX_STATS_ADD( p_dev, tx_bytes, ( cmd_size + (( NULL != p_tx ) ? size : 0UL )));
+	_25LCXXXX_STATS_ADD( p_dev, rx_bytes, (( NULL != p_rx ) ? size : 0UL ));
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Enable write latch
+*
+* @param[in]	p_dev	- Pointer to device context
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_write_enable(_25lcxxxx_dev_t * const p_dev)
+{
+	_25lcxxxx_status_t 	status 	= e25LCXXXX_OK;
+	const uint8_t		cmd		= e25LCXXXX_ISA_WREN;
+
+	status = _25lcxxxx_transfer( p_dev, &cmd, 1UL, NULL, NULL, 0UL );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Disable write latch
+*
+* @param[in]	p_dev	- Pointer to device context
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_write_disable(_25lcxxxx_dev_t * const p_dev)
+{
+	_25lcxxxx_status_t 	status 	= e25LCXXXX_OK;
+	const uint8_t		cmd		= e25LCXXXX_ISA_WRDI;
+
+	status = _25lcxxxx_transfer( p_dev, &cmd, 1UL, NULL, NULL, 0UL );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read status register from device
+*
+* @param[in]	p_dev			- Pointer to device context
+* @param[out]	p_status_reg	- Pointer to status register
+* @return 		status 			- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_read_status(_25lcxxxx_dev_t * const p_dev, _25lcxxxx_status_reg_t * const p_status_reg)
+{
+	_25lcxxxx_status_t 	status 	= e25LCXXXX_OK;
+	const uint8_t		cmd		= e25LCXXXX_ISA_RDST;
+
+	status = _25lcxxxx_transfer( p_dev, &cmd, 1UL, NULL, (uint8_t*) p_status_reg, 1UL );
+
+	_25LCXXXX_STATS_ADD( p_dev, poll_cnt, 1UL );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write to device status register
+*
+* @note	Status register write needs write enable latch set.
+*
+* @param[in]	p_dev			- Pointer to device context
+* @param[in]	p_status_reg	- Pointer to status register
+* @return 		status 			- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_write_status(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_status_reg_t * const p_status_reg)
+{
+	_25lcxxxx_status_t 	status 	= e25LCXXXX_OK;
+	const uint8_t		cmd		= e25LCXXXX_ISA_WDST;
+
+	// Enable write enable latch
+	status = _25lcxxxx_write_enable( p_dev );
+
+	if ( e25LCXXXX_OK == status )
+	{
+		status = _25lcxxxx_transfer( p_dev, &cmd, 1UL, (const uint8_t*) p_status_reg, NULL, 1UL );
+	}
+
+	if ( e25LCXXXX_OK == status )
+	{
+		_25lcxxxx_cycle_start( p_dev, false );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate number of sectors
+*
+*	This function calculates how many pages consumes area with a
+*	start of address and with a size of size argument. It is being
+*	used in write function.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	addr		- Start address of area
+* @param[in]	size		- Size of area
+* @return 		sector_num	- Number of sectors in that area
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t _25lcxxxx_calc_num_of_sectors(const _25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size)
+{
+	uint32_t sector_num = 0UL;
+	uint32_t k_a 		= 0UL;
+	uint32_t k_s		= 0UL;
+
+	// Unused with fixed part profile
+	(void) p_dev;
+
+	// Calculate address & size factors of sector size
+	k_a = (uint32_t) ( addr & ~_25LCXXXX_DEV_PAGE_MASK( p_dev ));
+	k_s = (uint32_t) (( addr + size - 1UL ) & ~_25LCXXXX_DEV_PAGE_MASK( p_dev ));
+
+	// Based on address & size factors number of sectors can be calculated
+	sector_num = (( k_s - k_a ) / _25LCXXXX_DEV_PAGE_SIZE( p_dev )) + 1UL;
+
+	return sector_num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate transfer size of data in bytes
+*
+*	This function caclulated based on address and size how many bytes are
+*	in current page. In other words what amount of bytes can be written until
+*	page boundary is hit. It is being used for write function.
+*
+* @param[in]	p_dev	- Pointer to device context
+* @param[in]	addr	- Start address
+* @param[in]	size	- Size of bytes
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t _25lcxxxx_calc_transfer_size(const _25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size)
+{
+	uint32_t bytes_to_transfer 	= 0UL;
+	uint32_t bytes_in_sector 	= 0UL;
+
+	// Unused with fixed part profile
+	(void) p_dev;
+
+	// Calculate how many bytes till page boundary
+	bytes_in_sector = _25LCXXXX_DEV_PAGE_SIZE( p_dev ) - ( addr & _25LCXXXX_DEV_PAGE_MASK( p_dev ));
+
+	// Bytes will not pass page boundary
+	if ( size <= bytes_in_sector )
+	{
+		bytes_to_transfer = size;
+	}
+
+	// Bytes will pass page boundary - limit to boundary
+	else
+	{
+		bytes_to_transfer = bytes_in_sector;
+	}
+
+	return bytes_to_transfer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find next page of scatter write
+*
+*	Segments are not sorted, instead lowest address not yet written is
+*	searched among all of them, so that const segment array can be used
+*	as is and no additional memory is needed.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	p_seg		- Pointer to segments
+* @param[in]	seg_cnt		- Number of segments
+* @param[in]	from		- Lowest address not yet written
+* @param[out]	p_page_addr	- Start address of next page to write
+* @return 		found 		- There is page to write
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool _25lcxxxx_writev_next_page(const _25lcxxxx_dev_t * const p_dev, const _25lcxxxx_seg_t * const p_seg, const uint32_t seg_cnt, const uint32_t from, uint32_t * const p_page_addr)
+{
+	bool		found 	= false;
+	uint32_t	lowest	= 0UL;
+
+	// Unused with fixed part profile
+	(void) p_dev;
+
+	for ( uint32_t i = 0; i < seg_cnt; i++ )
+	{
+		const uint32_t end = p_seg[i].addr + p_seg[i].size;
+
+		if (	( p_seg[i].size > 0UL )
+			&&	( end > from ))
+		{
+			const uint32_t start = ( p_seg[i].addr > from ) ? p_seg[i].addr : from;
+
+			if (( false == found ) || ( start < lowest ))
+			{
+				lowest 	= start;
+				found	= true;
+			}
+		}
+	}
+
+	*p_page_addr = ( lowest & ~_25LCXXXX_DEV_PAGE_MASK( p_dev ));
+
+	return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Merge segments into page image
+*
+*	Part of each segment inside of page is limited to page boundary with
+*	same logic as page split of write.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	p_seg		- Pointer to segments
+* @param[in]	seg_cnt		- Number of segments
+* @param[in]	page_addr	- Start address of page
+* @param[out]	p_buf		- Page image
+* @param[out]	p_is_set	- Bytes of page image written by segments
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_writev_merge(const _25lcxxxx_dev_t * const p_dev, const _25lcxxxx_seg_t * const p_seg, const uint32_t seg_cnt, const uint32_t page_addr, uint8_t * const p_buf, bool * const p_is_set)
+{
+	const uint32_t page_end = page_addr + _25LCXXXX_DEV_PAGE_SIZE( p_dev );
+
+	for ( uint32_t i = 0; i < seg_cnt; i++ )
+	{
+		const uint32_t end = p_seg[i].addr + p_seg[i].size;
+
+		if (	( p_seg[i].size > 0UL )
+			&&	( p_seg[i].addr < page_end )
+			&&	( end > page_addr ))
+		{
+			const uint32_t start 	= ( p_seg[i].addr > page_addr ) ? p_seg[i].addr : page_addr;
+			const uint32_t size		= _25lcxxxx_calc_transfer_size( p_dev, start, ( end - start ));
+
+			memcpy( &p_buf[ start - page_addr ], &p_seg[i].p_data[ start - p_seg[i].addr ], size );
+			memset( &p_is_set[ start - page_addr ], true, size );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Assemble read/write command
+*
+* @note For know this function has been tested only on 25LC640 device!
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[out]	p_frame		- Pointer to cmd frame
+* @param[in]	rw_cmd		- Device command for read or write
+* @param[in]	addr		- Start address of read or write
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_assemble_rw_cmd(const _25lcxxxx_dev_t * const p_dev, _25lcxxxx_rw_cmd_t * const p_frame, const _25lcxxxx_isa_t rw_cmd, const uint32_t addr)
+{
+	// Unused with fixed part profile
+	(void) p_dev;
+
+	_25LCXXXX_ASSERT( NULL != p_frame );
+
+	p_frame->u 				= 0UL;
+	p_frame->field.cmd 		= rw_cmd;
+
+	if ( 2U == _25LCXXXX_DEV_CMD_SIZE( p_dev ))
+	{
+		p_frame->field.addr[0]	= ( addr 			& 0xFFU );
+
+		// 9 bit address specialty - A8 is part of instruction
+		if (( addr & 0x100U ) == 0x100U )
+		{
+			p_frame->field.cmd |= _25LCXXXX_A8_CMD_MASK;
+		}
+	}
+	else if ( 3U == _25LCXXXX_DEV_CMD_SIZE( p_dev ))
+	{
+		p_frame->field.addr[0]	= (( addr >> 8U ) 	& 0xFFU );
+		p_frame->field.addr[1]	= ( addr 			& 0xFFU );
+	}
+	else
+	{
+		p_frame->field.addr[0]	= (( addr >> 16U ) 	& 0xFFU );
+		p_frame->field.addr[1]	= (( addr >> 8U ) 	& 0xFFU );
+		p_frame->field.addr[2]	= ( addr 			& 0xFFU );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Send write command to device
+*
+*	This function sends write command with start address followed by data
+*	payload within single chip select frame. Device starts internal write
+*	cycle when chip select goes high.
+*
+* @note		Write enable latch must be set and device must not be busy with
+* 			previous write cycle!
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	addr		- Start address of write transfer
+* @param[in]	p_data		- Pointer to data payload
+* @param[in]	size		- Size of data payload
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_write_command(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint8_t * const p_data, const uint32_t size)
+{
+	_25lcxxxx_status_t 	status 	= e25LCXXXX_OK;
+	_25lcxxxx_rw_cmd_t	cmd		= { .u = 0 };
+
+	// Assemble command
+	_25lcxxxx_assemble_rw_cmd( p_dev, &cmd, e25LCXXXX_ISA_WRITE, addr );
+
+	// Send command & data payload
+	status = _25lcxxxx_transfer( p_dev, (uint8_t*) &cmd.u, _25LCXXXX_DEV_CMD_SIZE( p_dev ), p_data, NULL, size );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Program page
+*
+*	Enables write latch and sends write command with data payload. This
+*	function does not wait for write cycle to complete.
+*
+* @note		Data must not cross page boundary!
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	addr		- Start address of write transfer
+* @param[in]	size		- Size of data payload
+* @param[in]	p_data		- Pointer to data payload
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_program_page(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	// Enable write enable latch
+	status = _25lcxxxx_write_enable( p_dev );
+
+	if ( e25LCXXXX_OK == status )
+	{
+		// Send write command & data payload
+		status = _25lcxxxx_write_command( p_dev, addr, p_data, size );
+	}
+
+	if ( e25LCXXXX_OK == status )
+	{
+		_25lcxxxx_cycle_start( p_dev, true );
+	}
+
+	#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN )
+
+		// Keep copy for reads during write cycle, device ignores protected data
+		if (	( e25LCXXXX_OK == status )
+			&&	( false == _25lcxxxx_is_protected( p_dev, addr, size )))
+		{
+			memcpy( p_dev->fwd.data, p_data, size );
+			p_dev->fwd.addr = addr;
+			p_dev->fwd.size = size;
+		}
+		else
+		{
+			p_dev->fwd.size = 0UL;
+		}
+
+	#endif
+
+	#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+
+		// Keep cached page coherent
+		if (	( e25LCXXXX_OK == status )
+			&&	( false == _25lcxxxx_is_protected( p_dev, addr, size )))
+		{
+			_25lcxxxx_cache_update( p_dev, addr, size, p_data );
+		}
+		else
+		{
+			_25lcxxxx_cache_invalidate( p_dev, addr, size );
+		}
+
+	#endif
+
+	#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+
+		if ( e25LCXXXX_OK == status )
+		{
+			p_dev->stats.prog_cnt++;
+			_25lcxxxx_stats_wear( p_dev, addr, size );
+		}
+
+	#endif
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Send erase command
+*
+*	Enables write latch and sends page, sector or chip erase instruction.
+*	This function does not wait for erase cycle to complete.
+*
+* @note		Only for devices with extended instruction set!
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	erase_cmd	- Page, sector or chip erase instruction
+* @param[in]	addr		- Address inside page/sector to erase, ignored for chip erase
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_erase_command(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_isa_t erase_cmd, const uint32_t addr)
+{
+	_25lcxxxx_status_t 	status 		= e25LCXXXX_OK;
+	_25lcxxxx_rw_cmd_t	cmd			= { .u = 0 };
+	uint32_t			erase_size	= ( p_dev->max_addr + 1UL );
+
+	// Erased area
+	if ( e25LCXXXX_ISA_PE == erase_cmd )
+	{
+		erase_size = _25LCXXXX_DEV_PAGE_SIZE( p_dev );
+	}
+	else if ( e25LCXXXX_ISA_SE == erase_cmd )
+	{
+		erase_size = (( p_dev->max_addr + 1UL ) / _25LCXXXX_SECTOR_NUM );
+	}
+	else
+	{
+		// No actions...
+	}
+
+	const uint32_t erase_addr = (( e25LCXXXX_ISA_CE == erase_cmd ) ? 0UL : addr ) & ~( erase_size - 1UL );
+
+	// Used only by read cache & statistics
+	(void) erase_addr;
+
+	#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN )
+
+		// Forwarded data might get erased
+		p_dev->fwd.size = 0UL;
+
+	#endif
+
+	#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+
+		// Drop cached pages of erased area
+		_25lcxxxx_cache_invalidate( p_dev, erase_addr, erase_size );
+
+	#endif
+
+	// Enable write enable latch
+	status = _25lcxxxx_write_enable( p_dev );
+
+	if ( e25LCXXXX_OK == status )
+	{
+		if ( e25LCXXXX_ISA_CE == erase_cmd )
+		{
+			cmd.field.cmd = erase_cmd;
+			status = _25lcxxxx_transfer( p_dev, (uint8_t*) &cmd.u, 1UL, NULL, NULL, 0UL );
+		}
+		else
+		{
+			_25lcxxxx_assemble_rw_cmd( p_dev, &cmd, erase_cmd, addr );
+			status = _25lcxxxx_transfer( p_dev, (uint8_t*) &cmd.u, _25LCXXXX_DEV_CMD_SIZE( p_dev ), NULL, NULL, 0UL );
+		}
+	}
+
+	if ( e25LCXXXX_OK == status )
+	{
+		_25lcxxxx_cycle_start( p_dev, false );
+	}
+
+	#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+
+		if ( e25LCXXXX_OK == status )
+		{
+			p_dev->stats.erase_cnt++;
+			_25lcxxxx_stats_wear( p_dev, erase_addr, erase_size );
+		}
+
+	#endif
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read electronic signature
+*
+*	Sends RDID instruction with dummy address and reads signature. This also
+*	releases device from deep power-down.
+*
+* @note		Only for devices with extended instruction set!
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[out]	p_sig		- Pointer to electronic signature
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_read_signature(_25lcxxxx_dev_t * const p_dev, uint8_t * const p_sig)
+{
+	_25lcxxxx_status_t 	status 	= e25LCXXXX_OK;
+	_25lcxxxx_rw_cmd_t	cmd		= { .u = 0 };
+
+	// Assemble command
+	_25lcxxxx_assemble_rw_cmd( p_dev, &cmd, e25LCXXXX_ISA_RDID, 0UL );
+
+	// Send command & read signature
+	status = _25lcxxxx_transfer( p_dev, (uint8_t*) &cmd.u, _25LCXXXX_DEV_CMD_SIZE( p_dev ), NULL, p_sig, 1UL );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Enter deep power-down
+*
+* @note		Device must not be busy with write cycle!
+*
+* @param[in]	p_dev		- Pointer to device context
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_enter_power_down(_25lcxxxx_dev_t * const p_dev)
+{
+	_25lcxxxx_status_t 	status 	= e25LCXXXX_OK;
+	const uint8_t		cmd		= e25LCXXXX_ISA_DPD;
+
+	status = _25lcxxxx_transfer( p_dev, &cmd, 1UL, NULL, NULL, 0UL );
+
+	if ( e25LCXXXX_OK == status )
+	{
+		p_dev->dpd.is_down = true;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wake up device from deep power-down
+*
+*	Releases device with RDID instruction and waits release time. Time spent
+*	waiting is accounted into wake-up statistics.
+*
+* @note		Without microsecond time interface two system timeticks are
+* 			waited, as first one can come right after release.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_wake_up(_25lcxxxx_dev_t * const p_dev)
+{
+	_25lcxxxx_status_t 	status 		= e25LCXXXX_OK;
+	uint8_t				sig			= 0U;
+	uint32_t			latency_us	= 0UL;
+	uint32_t 			safe_cnt	= 1000000UL;
+
+	// Clear first as release goes through transfer as well
+	p_dev->dpd.is_down = false;
+
+	status = _25lcxxxx_read_signature( p_dev, &sig );
+
+	if ( e25LCXXXX_OK == status )
+	{
+		// Wait release time
+		if (	( NULL != p_dev->cfg.p_if->pf_delay_us )
+			||	( NULL != p_dev->cfg.p_if->pf_get_sys_time_us ))
+		{
+			_25lcxxxx_sleep_us( p_dev, _25LCXXXX_DPD_RELEASE_TIME_US );
+			latency_us = _25LCXXXX_DPD_RELEASE_TIME_US;
+		}
+		else
+		{
+			// Time from release on
+			const uint32_t start = p_dev->cfg.p_if->pf_get_sys_time_ms();
+
+			while (	((uint32_t) ( p_dev->cfg.p_if->pf_get_sys_time_ms() - start ) < 2UL )
+				&&	( safe_cnt > 0UL ))
+			{
+				// Decrement safety counter
+				safe_cnt--;
+			}
+
+			latency_us = (uint32_t) ( p_dev->cfg.p_if->pf_get_sys_time_ms() - start ) * 1000UL;
+
+			// Timetick stalled - release time not guaranteed
+			if ( 0UL == safe_cnt )
+			{
+				status = e25LCXXXX_ERROR;
+			}
+		}
+	}
+
+	if ( e25LCXXXX_OK == status )
+	{
+		p_dev->dpd.stats.wake_cnt++;
+		p_dev->dpd.stats.wake_latency_us += latency_us;
+	}
+	else
+	{
+		p_dev->dpd.is_down = true;
+	}
+
+	_25LCXXXX_ASSERT( safe_cnt > 0 );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set device geometry
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	addr_bits	- Number of address bits
+* @param[in]	page_size	- Page size in bytes
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_set_geometry(_25lcxxxx_dev_t * const p_dev, const uint8_t addr_bits, const uint16_t page_size)
+{
+	p_dev->cfg.addr_bits 	= addr_bits;
+	p_dev->cfg.page_size 	= page_size;
+	p_dev->max_addr			= (uint32_t) (( 1UL << addr_bits ) - 1UL );
+	p_dev->page_mask		= (uint32_t) ( page_size - 1UL );
+
+	// Based on number of address bits command is being divided!
+	if ( addr_bits <= 9U )
+	{
+		p_dev->cmd_size = 2U;
+	}
+	else if ( addr_bits <= 16U )
+	{
+		p_dev->cmd_size = 3U;
+	}
+	else
+	{
+		p_dev->cmd_size = 4U;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Detect device geometry
+*
+*	Devices with extended instruction set are recognized by electronic
+*	signature. Others are probed for address and page wrap and result is
+*	stored into cache record, so probing is done only once.
+*
+* @note		Probing temporarily modifies (and restores) byte at address 0
+* 			and bytes around page boundaries 16 to 256.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_detect_geometry(_25lcxxxx_dev_t * const p_dev)
+{
+	_25lcxxxx_status_t 	status 		= e25LCXXXX_OK;
+	uint8_t				rec[ _25LCXXXX_DETECT_REC_SIZE ];
+	uint8_t				sig			= 0U;
+	uint8_t				addr_bits	= 0U;
+	uint16_t			page_size	= _25LCXXXX_PAGE_SIZE_MIN;
+	bool				ext_isa		= false;
+
+	const uint32_t rec_addr = p_dev->cfg.detect_addr;
+
+	// Cache record must fit into smallest device & page of address class
+	_25LCXXXX_ASSERT( 0UL == ( rec_addr & ( _25LCXXXX_DETECT_REC_SIZE - 1UL )));
+	_25LCXXXX_ASSERT(( rec_addr + _25LCXXXX_DETECT_REC_SIZE ) <= ( 1UL << _25LCXXXX_ADDR_BIT_NUM_MIN ));
+
+	// Work with largest device of address class until detected
+	if ( 2U == p_dev->cmd_size )
+	{
+		addr_bits = 9U;
+	}
+	else if ( 3U == p_dev->cmd_size )
+	{
+		addr_bits = 16U;
+	}
+	else
+	{
+		addr_bits = 17U;
+	}
+
+	_25lcxxxx_set_geometry( p_dev, addr_bits, _25LCXXXX_PAGE_SIZE_MIN );
+
+	// Electronic signature - 25XX512 or 25XX1024
+	if ( p_dev->cmd_size > 2U )
+	{
+		status = _25lcxxxx_read_signature( p_dev, &sig );
+	}
+
+	if ( _25LCXXXX_SIGNATURE == sig )
+	{
+		ext_isa 	= true;
+		page_size 	= (( 16U == addr_bits ) ? 128U : 256U );
+	}
+	else if ( e25LCXXXX_OK == status )
+	{
+		status = _25lcxxxx_read_command( p_dev, rec_addr, rec, _25LCXXXX_DETECT_REC_SIZE );
+
+		// Cached result
+		if (	( e25LCXXXX_OK == status )
+			&&	( _25LCXXXX_DETECT_MAGIC == rec[0] )
+			&&	((uint8_t) ( rec[0] ^ rec[1] ^ rec[2] ^ 0xFFU ) == rec[3] ))
+		{
+			addr_bits 	= rec[1];
+			page_size	= (uint16_t) ( 1UL << rec[2] );
+		}
+
+		// Probe for wrap around
+		else if ( e25LCXXXX_OK == status )
+		{
+			status = _25lcxxxx_probe_addr_bits( p_dev, &addr_bits );
+
+			if ( e25LCXXXX_OK == status )
+			{
+				_25lcxxxx_set_geometry( p_dev, addr_bits, _25LCXXXX_PAGE_SIZE_MIN );
+				status = _25lcxxxx_probe_page_size( p_dev, &page_size );
+			}
+
+			// Cache result
+			if ( e25LCXXXX_OK == status )
+			{
+				rec[0] = _25LCXXXX_DETECT_MAGIC;
+				rec[1] = addr_bits;
+				rec[2] = 0U;
+
+				while (( 1UL << rec[2] ) < page_size )
+				{
+					rec[2]++;
+				}
+
+				rec[3] = (uint8_t) ( rec[0] ^ rec[1] ^ rec[2] ^ 0xFFU );
+
+				status = _25lcxxxx_probe_write( p_dev, rec_addr, _25LCXXXX_DETECT_REC_SIZE, rec );
+			}
+		}
+	}
+
+	if ( e25LCXXXX_OK == status )
+	{
+		_25LCXXXX_ASSERT(( addr_bits >= _25LCXXXX_ADDR_BIT_NUM_MIN ) && ( addr_bits <= _25LCXXXX_ADDR_BIT_NUM_MAX ));
+
+		_25lcxxxx_set_geometry( p_dev, addr_bits, page_size );
+		p_dev->cfg.ext_isa = ext_isa;
+
+		// Deep power-down not supported
+		if ( false == ext_isa )
+		{
+			p_dev->cfg.dpd_timeout_ms = 0UL;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Probe number of address bits
+*
+*	Marker is written to address 0 and searched at addresses with single
+*	higher address bit set. Device ignores address bits above its size, so
+*	first address that follows changes of address 0 marks its size.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[out]	p_addr_bits	- Number of address bits
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_probe_addr_bits(_25lcxxxx_dev_t * const p_dev, uint8_t * const p_addr_bits)
+{
+	_25lcxxxx_status_t 	status 		= e25LCXXXX_OK;
+	uint8_t				orig		= 0U;
+	uint8_t				marker		= 0U;
+	uint8_t				val			= 0U;
+	uint8_t				bit			= 0U;
+
+	// Smallest device of address class
+	uint8_t bit_min = _25LCXXXX_ADDR_BIT_NUM_MIN;
+
+	if ( 3U == p_dev->cmd_size )
+	{
+		bit_min = 10U;
+	}
+	else if ( 4U == p_dev->cmd_size )
+	{
+		bit_min = _25LCXXXX_ADDR_BIT_NUM_MAX;
+	}
+
+	*p_addr_bits = p_dev->cfg.addr_bits;
+
+	status = _25lcxxxx_probe_read( p_dev, 0UL, &orig );
+	marker = (uint8_t) ~orig;
+
+	if ( e25LCXXXX_OK == status )
+	{
+		status = _25lcxxxx_probe_write( p_dev, 0UL, 1UL, &marker );
+	}
+
+	for ( bit = bit_min; ( bit < p_dev->cfg.addr_bits ) && ( e25LCXXXX_OK == status ); bit++ )
+	{
+		status = _25lcxxxx_probe_read( p_dev, ( 1UL << bit ), &val );
+
+		if (( e25LCXXXX_OK == status ) && ( marker == val ))
+		{
+			// Confirm by restoring address 0
+			status |= _25lcxxxx_probe_write( p_dev, 0UL, 1UL, &orig );
+			status |= _25lcxxxx_probe_read( p_dev, ( 1UL << bit ), &val );
+
+			if ( orig == val )
+			{
+				*p_addr_bits = bit;
+				break;
+			}
+
+			status |= _25lcxxxx_probe_write( p_dev, 0UL, 1UL, &marker );
+		}
+	}
+
+	// Restore
+	status |= _25lcxxxx_probe_write( p_dev, 0UL, 1UL, &orig );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Probe page size
+*
+*	Two bytes are programmed across candidate page boundary, from smallest
+*	candidate up. Device wraps second byte to start of page when candidate
+*	is its page size.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[out]	p_page_size	- Page size in bytes
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_probe_page_size(_25lcxxxx_dev_t * const p_dev, uint16_t * const p_page_size)
+{
+	_25lcxxxx_status_t 	status 		= e25LCXXXX_OK;
+	uint8_t				orig[3]		= { 0 };
+	uint8_t				data[2]		= { 0 };
+	uint8_t				val			= 0U;
+
+	*p_page_size = _25LCXXXX_PAGE_SIZE_MAX;
+
+	for ( uint32_t page = _25LCXXXX_PAGE_SIZE_MIN; ( page < _25LCXXXX_PAGE_SIZE_MAX ) && ( page <= p_dev->max_addr ) && ( e25LCXXXX_OK == status ); page <<= 1U )
+	{
+		status |= _25lcxxxx_probe_read( p_dev, 0UL, &orig[0] );
+		status |= _25lcxxxx_probe_read( p_dev, ( page - 1UL ), &orig[1] );
+		status |= _25lcxxxx_probe_read( p_dev, page, &orig[2] );
+
+		data[0] = (uint8_t) ~orig[1];
+		data[1] = (uint8_t) ~orig[0];
+
+		// Deliberately across page boundary
+		if ( e25LCXXXX_OK == status )
+		{
+			status = _25lcxxxx_probe_write( p_dev, ( page - 1UL ), 2UL, data );
+		}
+
+		status |= _25lcxxxx_probe_read( p_dev, 0UL, &val );
+
+		// Restore
+		status |= _25lcxxxx_probe_write( p_dev, 0UL, 1UL, &orig[0] );
+		status |= _25lcxxxx_probe_write( p_dev, ( page - 1UL ), 1UL, &orig[1] );
+		status |= _25lcxxxx_probe_write( p_dev, page, 1UL, &orig[2] );
+
+		// Second byte wrapped to address 0
+		if (( e25LCXXXX_OK == status ) && ( data[1] == val ))
+		{
+			*p_page_size = (uint16_t) page;
+			break;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read single byte while probing
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	addr		- Address
+* @param[out]	p_val		- Pointer to read value
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_probe_read(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, uint8_t * const p_val)
+{
+	return _25lcxxxx_read_command( p_dev, addr, p_val, 1UL );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Program bytes while probing and wait for write cycle
+*
+* @note		Page boundary is not checked!
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	addr		- Start address
+* @param[in]	size		- Number of bytes
+* @param[in]	p_data		- Pointer to data
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_probe_write(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	status = _25lcxxxx_program_page( p_dev, addr, size, p_data );
+
+	if ( e25LCXXXX_OK == status )
+	{
+		status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Finish non-blocking write job
+*
+* @note		User is notified by caller after lock is released, so that
+* 			callback can access device.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	status		- Result of write job
+* @return 		pf_done		- Completion callback to notify, can be NULL
+*/
+////////////////////////////////////////////////////////////////////////////////
+static pf_25lcxxxx_async_cb_t _25lcxxxx_async_finish(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_status_t status)
+{
+	pf_25lcxxxx_async_cb_t pf_done = p_dev->async.pf_done;
+
+	p_dev->async.p_data 	= NULL;
+	p_dev->async.size		= 0UL;
+	p_dev->async.pf_done 	= NULL;
+	p_dev->async.state		= ( e25LCXXXX_OK == status ) ? e25LCXXXX_ASYNC_IDLE : e25LCXXXX_ASYNC_ERROR;
+
+	return pf_done;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Advance non-blocking write job
+*
+*	Reads device status once and programs next page when device is no
+*	longer busy. Finishes job on error, timeout or when all pages are
+*	written.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[out]	p_pf_done	- Completion callback to notify when job finished
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_async_step(_25lcxxxx_dev_t * const p_dev, pf_25lcxxxx_async_cb_t * const p_pf_done)
+{
+	_25lcxxxx_status_t 		status				= e25LCXXXX_OK;
+	_25lcxxxx_status_reg_t	stat_reg			= { .u = 0 };
+	uint32_t				bytes_to_transfer	= 0UL;
+
+	status = _25lcxxxx_read_status( p_dev, &stat_reg );
+
+	if ( e25LCXXXX_OK != status )
+	{
+		*p_pf_done = _25lcxxxx_async_finish( p_dev, status );
+	}
+
+	// Device still busy with write cycle
+	else if ( true == stat_reg.b.wip )
+	{
+		if ((uint32_t) ( p_dev->cfg.p_if->pf_get_sys_time_ms() - p_dev->async.tick ) > _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ))
+		{
+			status = e25LCXXXX_ERROR;
+			*p_pf_done = _25lcxxxx_async_finish( p_dev, status );
+		}
+	}
+
+	// Last page written
+	else if ( 0UL == p_dev->async.size )
+	{
+		*p_pf_done = _25lcxxxx_async_finish( p_dev, e25LCXXXX_OK );
+	}
+
+	// Program next page
+	else
+	{
+		bytes_to_transfer = _25lcxxxx_calc_transfer_size( p_dev, p_dev->async.addr, p_dev->async.size );
+
+		status = _25lcxxxx_program_page( p_dev, p_dev->async.addr, bytes_to_transfer, p_dev->async.p_data );
+
+		if ( e25LCXXXX_OK == status )
+		{
+			p_dev->async.tick 	= p_dev->cfg.p_if->pf_get_sys_time_ms();
+			p_dev->async.p_data += bytes_to_transfer;
+			p_dev->async.addr	+= bytes_to_transfer;
+			p_dev->async.size	-= bytes_to_transfer;
+		}
+		else
+		{
+			*p_pf_done = _25lcxxxx_async_finish( p_dev, status );
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Send read command to device
+*
+*	This function sends read command with start address and receives
+*	data payload within single chip select frame.
+*
+* 	@note	Before reading from device it is important to check for
+* 			Write-In-Progress (WIP) flag in status register.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	addr		- Start address of read transfer
+* @param[out]	p_data		- Pointer to read data
+* @param[in]	size		- Size of read data
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_read_command(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, uint8_t * const p_data, const uint32_t size)
+{
+	_25lcxxxx_status_t 		status 	= e25LCXXXX_OK;
+	_25lcxxxx_rw_cmd_t		cmd		= { .u = 0 };
+
+	// Assemble command
+	_25lcxxxx_assemble_rw_cmd( p_dev, &cmd, e25LCXXXX_ISA_READ, addr );
+
+	// Send command & receive data payload
+	status = _25lcxxxx_transfer( p_dev, (uint8_t*) &cmd.u, _25LCXXXX_DEV_CMD_SIZE( p_dev ), NULL, p_data, size );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read WIP flag from device
+*
+* @param[in]	p_dev	- Pointer to device context
+* @return 		wip 	- State of Write-In-Progress
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool _25lcxxxx_read_wip_flag(_25lcxxxx_dev_t * const p_dev)
+{
+	bool 					wip 		= false;
+	_25lcxxxx_status_reg_t	stat_reg	= { .u = 0 };
+
+	if ( e25LCXXXX_OK == _25lcxxxx_read_status( p_dev, & stat_reg ))
+	{
+		wip = (bool) ( stat_reg.b.wip );
+
+		// Write cycle over
+		if ( false == wip )
+		{
+			p_dev->cycle.is_active 	= false;
+			p_dev->cycle.is_known 	= true;
+		}
+	}
+	else
+	{
+		p_dev->cycle.is_active = false;
+	}
+
+	#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN )
+
+		// Data is read from device from now on
+		if ( false == wip )
+		{
+			p_dev->fwd.size = 0UL;
+		}
+
+	#endif
+
+	return wip;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read WEL flag from device
+*
+* @param[in]	p_dev	- Pointer to device context
+* @return 		wel 	- State of Write-Enable-Latch
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool _25lcxxxx_read_wel_flag(_25lcxxxx_dev_t * const p_dev)
+{
+	bool wel = false;
+	_25lcxxxx_status_reg_t	stat_reg	= { .u = 0 };
+
+	if ( e25LCXXXX_OK == _25lcxxxx_read_status( p_dev, & stat_reg ))
+	{
+		wel = (bool) ( stat_reg.b.wel );
+	}
 
 	return wel;
 }
 
+#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN ) || ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Check if memory range touches block protected area
+	*
+	* @param[in]	p_dev	- Pointer to device context
+	* @param[in]	addr	- Start address of range
+	* @param[in]	size	- Size of range
+	* @return 		is_prot	- True if device ignores writes to (part of) range
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static bool _25lcxxxx_is_protected(const _25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size)
+	{
+		const uint32_t	mem_size	= p_dev->max_addr + 1UL;
+		uint32_t		prot_addr	= mem_size;
+
+		if ( e25LCXXXX_PROTECT_UPPER_1_4 == p_dev->prot )
+		{
+			prot_addr = mem_size - ( mem_size / 4UL );
+		}
+		else if ( e25LCXXXX_PROTECT_UPPER_1_2 == p_dev->prot )
+		{
+			prot_addr = mem_size / 2UL;
+		}
+		else if ( e25LCXXXX_PROTECT_UPPER_ALL == p_dev->prot )
+		{
+			prot_addr = 0UL;
+		}
+		else
+		{
+			// No actions...
+		}
+
+		return (( addr + size ) > prot_addr );
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait for device to write to internal memory array
+*
+*	This function blocks for maximum time of timeout. With microsecond time
+*	interface status is read at learned write cycle time, otherwise on
+*	system timeticks.
+*
+*	When driver can tell that device is idle status is not read at all.
+*	After failed wait device is asked again on next wait.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	timeout 	- Timeout in miliseconds
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_wait_for_write_process(_25lcxxxx_dev_t * const p_dev, const uint32_t timeout)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	if ( true == _25lcxxxx_cycle_is_over( p_dev ))
+	{
+		_25LCXXXX_STATS_ADD( p_dev, poll_skip_cnt, 1UL );
+	}
+	else if ( NULL != p_dev->cfg.p_if->pf_get_sys_time_us )
+	{
+		status = _25lcxxxx_wait_adaptive( p_dev, timeout );
+	}
+	else
+	{
+		status = _25lcxxxx_wait_tick( p_dev, timeout );
+	}
+
+	// Device state unknown
+	if ( e25LCXXXX_OK != status )
+	{
+		p_dev->cycle.is_known = false;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait for write cycle on system timeticks
+*
+*	This function blocks for maximum time of timeout and continuously check
+*	for WIP flag every 1ms.
+*
+*	When "_25lcxxxx_if_delay_us" is available it sleeps expected write cycle
+*	time right after write cycle was started, before first status read,
+*	and then sleeps "_25LCXXXX_CFG_WAIT_POLL_US" between status reads. So
+*	with RTOS sleep behind it calling task gives CPU to other tasks instead
+*	of polling. Lock is released while sleeping.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	timeout 	- Timeout in miliseconds
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_wait_tick(_25lcxxxx_dev_t * const p_dev, const uint32_t timeout)
+{
+	_25lcxxxx_status_t 				status 		= e25LCXXXX_OK;
+	const _25lcxxxx_if_t * const	p_if		= p_dev->cfg.p_if;
+	uint32_t						tick_prev	= 0UL;
+	uint32_t						tick		= 0UL;
+	uint32_t 						safe_cnt	= 1000000UL;
+	bool							wip_flag	= false;
+	uint8_t							timeout_cnt = 0U;
+
+	// Get current tick
+	tick = p_if->pf_get_sys_time_ms();
+	tick_prev = tick;
+
+	#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+		const uint32_t				tick_start	= tick;
+		bool						is_wait		= false;
+	#endif
+
+	// Write cycle just started - no need to ask device before it could end
+	if (	( true == p_dev->cycle.is_active )
+		&&	( NULL != p_if->pf_delay_us ))
+	{
+		(void) _25lcxxxx_sleep_unlocked( p_dev, _25LCXXXX_CFG_WAIT_TWC_US );
+
+		#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+			is_wait = true;
+		#endif
+	}
+
+	// Read WIP flag
+	wip_flag = _25lcxxxx_read_wip_flag( p_dev );
+
+	// Write is in progress - check for timeout amount of time
+	if ( true == wip_flag )
+	{
+		#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+			is_wait = true;
+		#endif
+
+		// Continuously check for WIP
+		while ( safe_cnt > 0 )
+		{
+			// Sleep between reads
+			if ( NULL != p_if->pf_delay_us )
+			{
+				// Other task started new write cycle meanwhile - restart timeout
+				if ( true == _25lcxxxx_sleep_unlocked( p_dev, _25LCXXXX_CFG_WAIT_POLL_US ))
+				{
+					timeout_cnt = 0U;
+				}
+
+				// Read WIP flag
+				wip_flag = _25lcxxxx_read_wip_flag( p_dev );
+
+				if ( false == wip_flag )
+				{
+					break;
+				}
+
+				// Get current timetick
+				tick = p_if->pf_get_sys_time_ms();
+
+				if ( (uint32_t) ( tick - tick_prev ) >= 1UL )
+				{
+					tick_prev = tick;
+					timeout_cnt++;
+				}
+			}
+			else
+			{
+				// Get current timetick
+				tick = p_if->pf_get_sys_time_ms();
+
+				// Read every 1ms
+				if ( (uint32_t) ( tick - tick_prev ) >= 1UL )
+				{
+					tick_prev = tick;
+					timeout_cnt++;
+
+					// Read WIP flag
+					wip_flag = _25lcxxxx_read_wip_flag( p_dev );
+
+					if ( false == wip_flag )
+					{
+						break;
+					}
+				}
+			}
+
+			if ( timeout_cnt >= timeout )
+			{
+				status = e25LCXXXX_ERROR;
+				break;
+			}
+
+			// Decrement safety counter
+			safe_cnt--;
+		}
+	}
+
+	#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+
+		if ( true == is_wait )
+		{
+			_25lcxxxx_stats_wait( p_dev, (uint32_t) ( p_if->pf_get_sys_time_ms() - tick_start ), status );
+		}
+
+	#endif
+
+	_25LCXXXX_ASSERT( safe_cnt > 0 );
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait for write cycle on microsecond time base
+*
+*	After page program first status read is done when learned write
+*	cycle time expires, following ones after short back-off of
+*	"_25LCXXXX_CFG_WAIT_POLL_US". Time of completed page program is used
+*	to refine learned write cycle time. Lock is released while sleeping.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	timeout 	- Timeout in miliseconds, from start of write cycle
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_wait_adaptive(_25lcxxxx_dev_t * const p_dev, const uint32_t timeout)
+{
+	_25lcxxxx_status_t 				status 		= e25LCXXXX_OK;
+	const _25lcxxxx_if_t * const	p_if		= p_dev->cfg.p_if;
+	const uint32_t					now			= p_if->pf_get_sys_time_us();
+	const bool						is_active	= p_dev->cycle.is_active;
+	const uint32_t					est			= p_dev->cycle.stats.est_us;
+	uint32_t						start		= (( true == is_active ) ? p_dev->cycle.start_us : now );
+	uint32_t 						safe_cnt	= 1000000UL;
+	bool							wip_flag	= false;
+	bool							is_busy		= false;
+	bool							is_learn	= (( true == is_active ) && ( true == p_dev->cycle.is_prog ));
+
+	// Sleep until expected completion
+	if ( true == is_active )
+	{
+		const uint32_t elapsed_us = (uint32_t) ( now - start );
+
+		if (	( elapsed_us < est )
+			&&	( true == _25lcxxxx_sleep_unlocked( p_dev, ( est - elapsed_us ))))
+		{
+			// Other task started new write cycle meanwhile
+			start 		= p_dev->cycle.start_us;
+			is_learn	= false;
+		}
+	}
+
+	// Read WIP flag
+	wip_flag 	= _25lcxxxx_read_wip_flag( p_dev );
+	is_busy 	= wip_flag;
+
+	// Back-off until write cycle completes
+	while (( true == wip_flag ) && ( safe_cnt > 0UL ))
+	{
+		if ((uint32_t) ( p_if->pf_get_sys_time_us() - start ) >= ( timeout * 1000UL ))
+		{
+			status = e25LCXXXX_ERROR;
+			break;
+		}
+
+		if ( true == _25lcxxxx_sleep_unlocked( p_dev, _25LCXXXX_CFG_WAIT_POLL_US ))
+		{
+			start 		= p_dev->cycle.start_us;
+			is_learn	= false;
+		}
+
+		// Read WIP flag
+		wip_flag = _25lcxxxx_read_wip_flag( p_dev );
+
+		// Decrement safety counter
+		safe_cnt--;
+	}
+
+	// Learn only from page programs as erase cycles are longer
+	if (	( e25LCXXXX_OK == status )
+		&&	( true == is_learn ))
+	{
+		_25lcxxxx_learn_twc( p_dev, (uint32_t) ( p_if->pf_get_sys_time_us() - start ), is_busy );
+	}
+
+	#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+
+		if (( true == is_active ) || ( true == is_busy ))
+		{
+			_25lcxxxx_stats_wait( p_dev, ((uint32_t) ( p_if->pf_get_sys_time_us() - now ) / 1000UL ), status );
+		}
+
+	#endif
+
+	_25LCXXXX_ASSERT( safe_cnt > 0 );
+
+	return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*		Wait for device to write to internal memory array
+*		Mark start of write cycle
 *
-*	This function blocks for maximum time of timeout and continuously check
-*	for WIP flag every 1ms.
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	is_prog		- Write cycle is page program
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_cycle_start(_25lcxxxx_dev_t * const p_dev, const bool is_prog)
+{
+	p_dev->cycle.is_active 	= true;
+	p_dev->cycle.is_prog	= is_prog;
+	p_dev->cycle.start_ms	= p_dev->cfg.p_if->pf_get_sys_time_ms();
+	p_dev->cycle.seq++;
+
+	if ( NULL != p_dev->cfg.p_if->pf_get_sys_time_us )
+	{
+		p_dev->cycle.start_us = p_dev->cfg.p_if->pf_get_sys_time_us();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Is write cycle over without asking device
 *
-* @param[in]	timeout 	- Timeout in miliseconds
-* @return 		status 		- Status of operation
+*	Device is idle for sure when it was seen idle and driver started no
+*	write cycle since, or when maximum write cycle time passed from start
+*	of last page program. Erase and status write cycles are not timed, as
+*	they might take longer.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @return 		is_over		- Device known to be idle
 */
 ////////////////////////////////////////////////////////////////////////////////
-static _25lcxxxx_status_t _25lcxxxx_wait_for_write_process(const uint32_t timeout)
+static bool _25lcxxxx_cycle_is_over(_25lcxxxx_dev_t * const p_dev)
 {
-	_25lcxxxx_status_t 	status 		= e25LCXXXX_OK;
-	uint32_t			tick_prev	= 0UL;
-	uint32_t			tick		= 0UL;
-	uint32_t 			safe_cnt	= 1000000UL;
-	bool				wip_flag	= false;
-	uint8_t				timeout_cnt = 0U;
+	const _25lcxxxx_if_t * const	p_if	= p_dev->cfg.p_if;
+	bool							is_over	= false;
 
-	// Read WIP flag
-	wip_flag = _25lcxxxx_read_wip_flag();
+	if ( false == p_dev->cycle.is_known )
+	{
+		// Device must be asked
+	}
+	else if ( false == p_dev->cycle.is_active )
+	{
+		is_over = true;
+	}
+	else if ( false == p_dev->cycle.is_prog )
+	{
+		// Not timed
+	}
+	else if ( NULL != p_if->pf_get_sys_time_us )
+	{
+		is_over = ((uint32_t) ( p_if->pf_get_sys_time_us() - p_dev->cycle.start_us ) >= _25LCXXXX_WAIT_TWC_MAX_US( p_dev ));
+	}
+	else
+	{
+		// Start timetick might be at its end
+		is_over = ((uint32_t) ( p_if->pf_get_sys_time_ms() - p_dev->cycle.start_ms ) > _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
+	}
 
-	// Write is in progress - check for timeout amount of time
-	if ( true == wip_flag )
+	if ( true == is_over )
 	{
-		// Get current tick
-		tick = _25lcxxxx_if_get_sys_time_ms();
-		tick_prev = tick;
+		p_dev->cycle.is_active = false;
 
-		// Continuously check for WIP
-		while ( safe_cnt > 0 )
+		#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN )
+			p_dev->fwd.size = 0UL;
+		#endif
+	}
+
+	return is_over;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Refine learned write cycle time
+*
+*	When write cycle was still in progress at first status read, its end
+*	is known within back-off time and learned time follows it. Otherwise
+*	write cycle might have been shorter than learned time, which is then
+*	slightly decreased, so that learned time settles at edge of real
+*	write cycle time.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	time_us		- Time from start of write cycle till it was seen completed
+* @param[in]	is_busy		- Write cycle in progress at first status read
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_learn_twc(_25lcxxxx_dev_t * const p_dev, const uint32_t time_us, const bool is_busy)
+{
+	_25lcxxxx_twc_stats_t * const p_twc = &p_dev->cycle.stats;
+
+	if ( true == is_busy )
+	{
+		// Running average
+		if ( time_us >= p_twc->est_us )
+		{
+			p_twc->est_us += (( time_us - p_twc->est_us ) / _25LCXXXX_TWC_LEARN_DIV );
+		}
+		else
+		{
+			p_twc->est_us -= (( p_twc->est_us - time_us ) / _25LCXXXX_TWC_LEARN_DIV );
+		}
+
+		if (( 0UL == p_twc->cnt ) || ( time_us < p_twc->min_us ))
+		{
+			p_twc->min_us = time_us;
+		}
+
+		if ( time_us > p_twc->max_us )
+		{
+			p_twc->max_us = time_us;
+		}
+
+		p_twc->cnt++;
+	}
+	else
+	{
+		p_twc->est_us -= ( p_twc->est_us / _25LCXXXX_TWC_SHRINK_DIV );
+	}
+
+	// Limit to sensible range
+	if ( p_twc->est_us < _25LCXXXX_CFG_WAIT_POLL_US )
+	{
+		p_twc->est_us = _25LCXXXX_CFG_WAIT_POLL_US;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sleep on microsecond time base
+*
+* @param[in]	p_dev	- Pointer to device context
+* @param[in]	us		- Sleep time in microseconds
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_sleep_us(_25lcxxxx_dev_t * const p_dev, const uint32_t us)
+{
+	const _25lcxxxx_if_t * const p_if = p_dev->cfg.p_if;
+
+	if ( NULL != p_if->pf_delay_us )
+	{
+		p_if->pf_delay_us( us );
+	}
+	else
+	{
+		const uint32_t start = p_if->pf_get_sys_time_us();
+
+		while ((uint32_t) ( p_if->pf_get_sys_time_us() - start ) < us )
+		{
+			// Wait...
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Lock access to device
+*
+* @param[in]	p_dev	- Pointer to device context
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_lock(_25lcxxxx_dev_t * const p_dev)
+{
+	if ( NULL != p_dev->cfg.p_if->pf_lock )
+	{
+		p_dev->cfg.p_if->pf_lock();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Unlock access to device
+*
+* @param[in]	p_dev	- Pointer to device context
+* @return 		void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void _25lcxxxx_unlock(_25lcxxxx_dev_t * const p_dev)
+{
+	if ( NULL != p_dev->cfg.p_if->pf_unlock )
+	{
+		p_dev->cfg.p_if->pf_unlock();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Sleep with device unlocked
+*
+*	Device is busy with write cycle, so other tasks can use this time. They
+*	wait for write cycle on their own and might start new one (e.g. program
+*	of other page), which is reported to caller. Caller keeps polling status
+*	after lock is taken back, so order of its own pages is preserved.
+*
+* @param[in]	p_dev		- Pointer to device context
+* @param[in]	us			- Sleep time in microseconds
+* @return 		is_new		- Other task started write cycle meanwhile
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool _25lcxxxx_sleep_unlocked(_25lcxxxx_dev_t * const p_dev, const uint32_t us)
+{
+	const uint32_t seq = p_dev->cycle.seq;
+
+	_25lcxxxx_unlock( p_dev );
+	_25lcxxxx_sleep_us( p_dev, us );
+	_25lcxxxx_lock( p_dev );
+
+	return ( seq != p_dev->cycle.seq );
+}
+
+#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Account program or erase cycle in wear map
+	*
+	* @param[in]	p_dev	- Pointer to device context
+	* @param[in]	addr	- Start address of programmed/erased area
+	* @param[in]	size	- Size of programmed/erased area
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void _25lcxxxx_stats_wear(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size)
+	{
+		const uint32_t page_num 	= (( p_dev->max_addr + 1UL ) / _25LCXXXX_DEV_PAGE_SIZE( p_dev ));
+		const uint32_t bin_first	= (( addr / _25LCXXXX_DEV_PAGE_SIZE( p_dev )) * _25LCXXXX_CFG_STATS_WEAR_BIN_NUM ) / page_num;
+		const uint32_t bin_last		= ((( addr + size - 1UL ) / _25LCXXXX_DEV_PAGE_SIZE( p_dev )) * _25LCXXXX_CFG_STATS_WEAR_BIN_NUM ) / page_num;
+
+		for ( uint32_t bin = bin_first; bin <= bin_last; bin++ )
+		{
+			if ( p_dev->stats.wear[bin] < UINT16_MAX )
+			{
+				p_dev->stats.wear[bin]++;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Account wait for write cycle
+	*
+	* @param[in]	p_dev	- Pointer to device context
+	* @param[in]	wait_ms	- Duration of wait
+	* @param[in]	status	- Result of wait
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void _25lcxxxx_stats_wait(_25lcxxxx_dev_t * const p_dev, const uint32_t wait_ms, const _25lcxxxx_status_t status)
+	{
+		p_dev->stats.wait_cnt++;
+		p_dev->stats.wait_total_ms += wait_ms;
+
+		if ( wait_ms > p_dev->stats.wait_max_ms )
+		{
+			p_dev->stats.wait_max_ms = wait_ms;
+		}
+
+		if ( e25LCXXXX_OK != status )
+		{
+			p_dev->stats.timeout_cnt++;
+		}
+	}
+
+#endif
+
+#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Read byte(s) through read cache
+	*
+	*	Read is served from cached pages. Missing pages are loaded into least
+	*	recently used slots, waiting for write cycle only once. When read
+	*	continues where previous one ended "_25LCXXXX_CFG_CACHE_RA_PAGE_NUM"
+	*	following pages are loaded as well. Reads of more pages than cache
+	*	holds bypass it.
+	*
+	* @param[in]	p_dev	- Pointer to device context
+	* @param[in]	addr	- Start address of read
+	* @param[in]	size	- Size of bytes to read
+	* @param[out]	p_data	- Pointer to read data
+	* @return 		status 	- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static _25lcxxxx_status_t _25lcxxxx_cache_read(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+	{
+		_25lcxxxx_status_t			status		= e25LCXXXX_OK;
+		_25lcxxxx_cache_slot_t *	p_slot		= NULL;
+		bool						is_hit		= true;
+		bool						is_ready	= false;
+
+		const uint32_t 	page_size 	= _25LCXXXX_DEV_PAGE_SIZE( p_dev );
+		const uint32_t 	first_page	= ( addr & ~_25LCXXXX_DEV_PAGE_MASK( p_dev ));
+		const uint32_t 	last_page	= (( addr + size - 1UL ) & ~_25LCXXXX_DEV_PAGE_MASK( p_dev ));
+		const bool		is_seq		= ( addr == p_dev->cache.next_addr );
+
+		p_dev->cache.next_addr = addr + size;
+
+		// Larger than cache
+		if ((( last_page - first_page ) / page_size ) >= _25LCXXXX_CFG_CACHE_SLOT_NUM )
 		{
-			// Get current timetick
-			tick = _25lcxxxx_if_get_sys_time_ms();
+			p_dev->cache.stats.miss_cnt++;
+
+			status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
 
-			// Read every 1ms
-			if ( (uint32_t) ( tick - tick_prev ) >= 1UL )
+			if ( e25LCXXXX_OK == status )
+			{
+				status = _25lcxxxx_read_command( p_dev, addr, p_data, size );
+			}
+		}
+		else
+		{
+			// Mark cached pages of read as used first, so that loading
+			// of missing pages does not replace them
+			for ( uint32_t page = first_page; page <= last_page; page += page_size )
 			{
-				tick_prev = tick;
-				timeout_cnt++;
+				p_slot = _25lcxxxx_cache_find( p_dev, page );
 
-				// Read WIP flag
-				wip_flag = _25lcxxxx_read_wip_flag();
+				if ( NULL != p_slot )
+				{
+					p_slot->last_use = ++p_dev->cache.use_cnt;
+				}
+				else
+				{
+					is_hit = false;
+				}
+			}
 
-				if ( false == wip_flag )
+			if ( true == is_hit )
+			{
+				p_dev->cache.stats.hit_cnt++;
+			}
+			else
+			{
+				p_dev->cache.stats.miss_cnt++;
+			}
+
+			for ( uint32_t page = first_page; ( page <= last_page ) && ( e25LCXXXX_OK == status ); page += page_size )
+			{
+				p_slot = _25lcxxxx_cache_find( p_dev, page );
+
+				if ( NULL == p_slot )
+				{
+					status = _25lcxxxx_cache_load( p_dev, page, &is_ready, &p_slot );
+				}
+
+				if ( e25LCXXXX_OK == status )
+				{
+					const uint32_t start 	= ( addr > page ) ? addr : page;
+					const uint32_t end 		= (( addr + size ) < ( page + page_size )) ? ( addr + size ) : ( page + page_size );
+
+					memcpy(( p_data + ( start - addr )), &p_slot->data[ start - page ], ( end - start ));
+				}
+			}
+
+			// Readahead of following pages
+			for ( uint32_t i = 1UL; ( true == is_seq ) && ( i <= _25LCXXXX_CFG_CACHE_RA_PAGE_NUM ) && ( e25LCXXXX_OK == status ); i++ )
+			{
+				const uint32_t page = last_page + ( i * page_size );
+
+				if ( page > p_dev->max_addr )
 				{
 					break;
 				}
+
+				if ( NULL == _25lcxxxx_cache_find( p_dev, page ))
+				{
+					status = _25lcxxxx_cache_load( p_dev, page, &is_ready, &p_slot );
+					p_dev->cache.stats.ra_cnt++;
+				}
 			}
+		}
 
-			if ( timeout_cnt >= timeout )
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Find cached page
+	*
+	* @param[in]	p_dev		- Pointer to device context
+	* @param[in]	page_addr	- Start address of page
+	* @return 		p_slot		- Pointer to slot, NULL if page is not cached
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static _25lcxxxx_cache_slot_t * _25lcxxxx_cache_find(_25lcxxxx_dev_t * const p_dev, const uint32_t page_addr)
+	{
+		_25lcxxxx_cache_slot_t * p_slot = NULL;
+
+		for ( uint32_t i = 0; i < _25LCXXXX_CFG_CACHE_SLOT_NUM; i++ )
+		{
+			if (	( true == p_dev->cache.slot[i].valid )
+				&&	( page_addr == p_dev->cache.slot[i].page_addr ))
 			{
-				status = e25LCXXXX_ERROR;
+				p_slot = &p_dev->cache.slot[i];
 				break;
 			}
+		}
 
-			// Decrement safety counter
-			safe_cnt--;
+		return p_slot;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Load page into cache
+	*
+	*	Page is read into free or least recently used slot.
+	*
+	* @param[in]	p_dev		- Pointer to device context
+	* @param[in]	page_addr	- Start address of page
+	* @param[in,out]p_is_ready	- Write cycle already waited for
+	* @param[out]	pp_slot		- Pointer to slot
+	* @return 		status 		- Status of operation
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static _25lcxxxx_status_t _25lcxxxx_cache_load(_25lcxxxx_dev_t * const p_dev, const uint32_t page_addr, bool * const p_is_ready, _25lcxxxx_cache_slot_t ** const pp_slot)
+	{
+		_25lcxxxx_status_t			status	= e25LCXXXX_OK;
+		_25lcxxxx_cache_slot_t *	p_slot	= &p_dev->cache.slot[0];
+
+		// Select free or least recently used slot
+		for ( uint32_t i = 0; i < _25LCXXXX_CFG_CACHE_SLOT_NUM; i++ )
+		{
+			if ( false == p_dev->cache.slot[i].valid )
+			{
+				p_slot = &p_dev->cache.slot[i];
+				break;
+			}
+			else if ( p_dev->cache.slot[i].last_use < p_slot->last_use )
+			{
+				p_slot = &p_dev->cache.slot[i];
+			}
+			else
+			{
+				// No actions...
+			}
+		}
+
+		// Wait for write process
+		// NOTE: Reading not possible when write in progress!
+		if ( false == *p_is_ready )
+		{
+			status = _25lcxxxx_wait_for_write_process( p_dev, _25LCXXXX_WAIT_WRITE_TIMEOUT_MS( p_dev ));
+			*p_is_ready = ( e25LCXXXX_OK == status );
+		}
+
+		if ( e25LCXXXX_OK == status )
+		{
+			p_slot->valid = false;
+
+			status = _25lcxxxx_read_command( p_dev, page_addr, p_slot->data, _25LCXXXX_DEV_PAGE_SIZE( p_dev ));
+
+			if ( e25LCXXXX_OK == status )
+			{
+				p_slot->page_addr 	= page_addr;
+				p_slot->valid 		= true;
+				p_slot->last_use 	= ++p_dev->cache.use_cnt;
+			}
+		}
+
+		*pp_slot = p_slot;
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Update cached page with programmed data
+	*
+	* @note		Data must not cross page boundary!
+	*
+	* @param[in]	p_dev	- Pointer to device context
+	* @param[in]	addr	- Start address of programmed data
+	* @param[in]	size	- Size of programmed data
+	* @param[in]	p_data	- Pointer to programmed data
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void _25lcxxxx_cache_update(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+	{
+		_25lcxxxx_cache_slot_t * const p_slot = _25lcxxxx_cache_find( p_dev, ( addr & ~_25LCXXXX_DEV_PAGE_MASK( p_dev )));
+
+		if ( NULL != p_slot )
+		{
+			memcpy( &p_slot->data[ addr & _25LCXXXX_DEV_PAGE_MASK( p_dev ) ], p_data, size );
 		}
 	}
 
-	_25LCXXXX_ASSERT( safe_cnt > 0 );
+	////////////////////////////////////////////////////////////////////////////////
+	/**
+	*		Drop cached pages of area
+	*
+	* @param[in]	p_dev	- Pointer to device context
+	* @param[in]	addr	- Start address of area
+	* @param[in]	size	- Size of area
+	* @return 		void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void _25lcxxxx_cache_invalidate(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size)
+	{
+		for ( uint32_t i = 0; i < _25LCXXXX_CFG_CACHE_SLOT_NUM; i++ )
+		{
+			_25lcxxxx_cache_slot_t * const p_slot = &p_dev->cache.slot[i];
 
-	return status;
-}
+			if (	( p_slot->page_addr < ( addr + size ))
+				&&	(( p_slot->page_addr + _25LCXXXX_DEV_PAGE_SIZE( p_dev )) > addr ))
+			{
+				p_slot->valid = false;
+			}
+		}
+	}
+
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -7,7 +7,7 @@
 *@brief    	API for 25LCxxxx EEPROM device
 *@author    Ziga Miklosic
 *@date      08.05.2021
-*@version	V1.0.2
+*@version	V1.1.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -24,6 +24,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include <stdint.h>
 #include <stdbool.h>
+#include "../../25lcxxxx_cfg.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
@@ -33,8 +34,8 @@
  * 	Module version
  */
 #define _25LCXXXX_VER_MAJOR		( 1 )
-#define _25LCXXXX_VER_MINOR		( 0 )
-#define _25LCXXXX_VER_DEVELOP	( 2 )
+#define _25LCXXXX_VER_MINOR		( 1 )
+#define _25LCXXXX_VER_DEVELOP	( 0 )
 
 /**
  * 	Status
@@ -46,6 +47,7 @@ typedef enum
 	e25LCXXXX_ERROR_SPI		= 0x02,		/**<SPI error */
 	e25LCXXXX_ERROR_INIT	= 0x04,		/**<Initialisation error */
 	e25LCXXXX_ERROR_ADDR	= 0x08,		/**<Invalid memory address */
+	e25LCXXXX_ERROR_BUSY	= 0x10,		/**<Non-blocking write in progress */
 } _25lcxxxx_status_t;
 
 /**
@@ -59,17 +61,285 @@ typedef enum
 	e25LCXXXX_PROTECT_UPPER_ALL,	/**<All sectors protected (Sector 0, 1, 2 & 3)*/
 } _25lcxxxx_protect_t;
 
+/**
+ * 	Non-blocking write state
+ */
+typedef enum
+{
+	e25LCXXXX_ASYNC_IDLE = 0,		/**<No write job pending */
+	e25LCXXXX_ASYNC_BUSY,			/**<Write job in progress */
+	e25LCXXXX_ASYNC_ERROR,			/**<Last write job failed */
+} _25lcxxxx_async_state_t;
+
+/**
+ * 	Non-blocking write completion callback
+ */
+typedef void (*pf_25lcxxxx_async_cb_t)(const _25lcxxxx_status_t status);
+
+/**
+ * 	Streaming read chunk consumer
+ */
+typedef void (*pf_25lcxxxx_read_cb_t)(const uint8_t * const p_data, const uint32_t size);
+
+/**
+ * 	Write segment of scatter write
+ */
+typedef struct
+{
+	uint32_t			addr;	/**<Start address */
+	uint32_t			size;	/**<Size of data, 0 to skip segment */
+	const uint8_t *		p_data;	/**<Pointer to data */
+} _25lcxxxx_seg_t;
+
+/**
+ * 	Device interface functions
+ *
+ * 	@note	Defined in "25lcxxxx_if.h" as it depends on platform SPI types.
+ */
+typedef struct _25lcxxxx_if_s _25lcxxxx_if_t;
+
+/**
+ * 	Device configuration
+ */
+typedef struct
+{
+	const _25lcxxxx_if_t *	p_if;			/**<Interface functions, must stay valid while device is in use */
+	uint8_t					addr_bits;		/**<Number of address bits (7-17) */
+	uint16_t				page_size;		/**<Page size in bytes (16-256, power of 2) */
+	bool					ext_isa;		/**<Page/sector/chip erase, deep power-down & ID instructions supported (25XX512, 25XX1024) */
+	uint32_t				jnl_addr;		/**<Start address of transaction journal region */
+	uint32_t				jnl_size;		/**<Size of transaction journal region, 0 for none */
+	uint32_t				dpd_timeout_ms;	/**<Idle time before entering deep power-down, 0 to disable (extended instruction set only) */
+	bool					detect;			/**<Detect geometry at initialization, addr_bits then only selects address size of command */
+	uint32_t				detect_addr;	/**<Address of 4 byte cache record of probed geometry */
+	uint32_t				twc_max_us;		/**<Maximum write cycle time in us, 0 for time of selected or detected part (6 ms if unknown) */
+} _25lcxxxx_dev_cfg_t;
+
+/**
+ * 	Non-blocking write job
+ */
+typedef struct
+{
+	const uint8_t *				p_data;		/**<Pointer to remaining write data */
+	uint32_t					addr;		/**<Next address to write */
+	uint32_t					size;		/**<Remaining bytes to write */
+	uint32_t					tick;		/**<Timetick of last page program */
+	pf_25lcxxxx_async_cb_t		pf_done;	/**<Completion callback */
+	_25lcxxxx_async_state_t		state;		/**<State of write job */
+} _25lcxxxx_async_job_t;
+
+/**
+ * 	Deep power-down statistics
+ */
+typedef struct
+{
+	uint32_t	wake_cnt;			/**<Number of wake-ups from deep power-down */
+	uint32_t	wake_latency_us;	/**<Total time added to accesses by wake-ups */
+} _25lcxxxx_dpd_stats_t;
+
+/**
+ * 	Deep power-down state
+ */
+typedef struct
+{
+	_25lcxxxx_dpd_stats_t	stats;			/**<Wake-up statistics */
+	uint32_t				last_access;	/**<Timetick of last access to device */
+	bool					is_down;		/**<Device in deep power-down */
+} _25lcxxxx_dpd_t;
+
+/**
+ * 	Write cycle time statistics
+ *
+ * 	@note	Only measured with microsecond time interface.
+ */
+typedef struct
+{
+	uint32_t	est_us;			/**<Learned write cycle time */
+	uint32_t	min_us;			/**<Shortest measured write cycle */
+	uint32_t	max_us;			/**<Longest measured write cycle */
+	uint32_t	cnt;			/**<Number of measured write cycles */
+} _25lcxxxx_twc_stats_t;
+
+/**
+ * 	Write cycle state
+ */
+typedef struct
+{
+	_25lcxxxx_twc_stats_t	stats;		/**<Write cycle time statistics */
+	uint32_t				start_us;	/**<Start time of last write cycle */
+	uint32_t				start_ms;	/**<Start timetick of last write cycle */
+	uint32_t				seq;		/**<Number of started write cycles */
+	bool					is_prog;	/**<Last write cycle is page program */
+	bool					is_active;	/**<Write cycle started and not yet seen finished */
+	bool					is_known;	/**<Device seen idle and driver tracks its write cycles since */
+} _25lcxxxx_cycle_t;
+
+/**
+ * 	Last programmed data, for read forwarding
+ */
+typedef struct
+{
+	uint32_t	addr;									/**<Start address of programmed data */
+	uint32_t	size;									/**<Size of programmed data, 0 when not valid */
+	uint8_t		data[_25LCXXXX_CFG_PAGE_SIZE_BYTE];		/**<Copy of programmed data */
+} _25lcxxxx_fwd_t;
+
+/**
+ * 	Read cache statistics
+ */
+typedef struct
+{
+	uint32_t	hit_cnt;		/**<Number of reads served from cache */
+	uint32_t	miss_cnt;		/**<Number of reads that accessed device */
+	uint32_t	ra_cnt;			/**<Number of pages loaded by readahead */
+} _25lcxxxx_cache_stats_t;
+
+#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+
+	/**
+	 * 	Read cache page slot
+	 */
+	typedef struct
+	{
+		uint32_t	page_addr;								/**<Start address of cached page */
+		uint32_t	last_use;								/**<Usage stamp for LRU replacement */
+		bool		valid;									/**<Page loaded */
+		uint8_t		data[_25LCXXXX_CFG_PAGE_SIZE_BYTE];		/**<Copy of page */
+	} _25lcxxxx_cache_slot_t;
+
+	/**
+	 * 	Read cache
+	 */
+	typedef struct
+	{
+		_25lcxxxx_cache_slot_t	slot[_25LCXXXX_CFG_CACHE_SLOT_NUM];		/**<Page slots */
+		_25lcxxxx_cache_stats_t	stats;									/**<Hit & miss statistics */
+		uint32_t				use_cnt;								/**<Usage counter */
+		uint32_t				next_addr;								/**<End of last read, for sequential access detection */
+	} _25lcxxxx_cache_t;
+
+#endif
+
+#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+
+	/**
+	 * 	Performance statistics
+	 */
+	typedef struct
+	{
+		uint32_t	cs_cnt;										/**<Number of bus transactions (chip select assertions) */
+		uint32_t	xfer_cnt;									/**<Number of interface transfer calls */
+		uint32_t	tx_bytes;									/**<Number of transmitted bytes, including commands */
+		uint32_t	rx_bytes;									/**<Number of received bytes */
+		uint32_t	read_cnt;									/**<Number of reads */
+		uint32_t	fwd_cnt;									/**<Number of reads served from last programmed data */
+		uint32_t	prog_cnt;									/**<Number of page programs */
+		uint32_t	erase_cnt;									/**<Number of page/sector/chip erase instructions */
+		uint32_t	poll_cnt;									/**<Number of status register reads */
+		uint32_t	poll_skip_cnt;								/**<Number of waits for write cycle without status read, device known idle */
+		uint32_t	wait_cnt;									/**<Number of waits for write cycle */
+		uint32_t	wait_total_ms;								/**<Total time of waits for write cycle */
+		uint32_t	wait_max_ms;								/**<Longest wait for write cycle */
+		uint32_t	timeout_cnt;								/**<Number of write cycle wait timeouts */
+		uint16_t	wear[_25LCXXXX_CFG_STATS_WEAR_BIN_NUM];		/**<Program & erase cycles by group of pages, saturated */
+	} _25lcxxxx_stats_t;
+
+#endif
+
+/**
+ * 	Device context
+ *
+ * 	@note	Members are private to driver. User only allocates device
+ * 			context and passes it to "_25lcxxxx_dev_*" functions.
+ */
+typedef struct
+{
+	_25lcxxxx_dev_cfg_t		cfg;		/**<Device configuration */
+	uint32_t				max_addr;	/**<Highest memory address */
+	uint32_t				page_mask;	/**<Page offset mask */
+	uint8_t					cmd_size;	/**<Size of read/write command */
+	bool					is_init;	/**<Initialization guard */
+	_25lcxxxx_cycle_t		cycle;		/**<Write cycle state */
+	_25lcxxxx_async_job_t	async;		/**<Non-blocking write job */
+	_25lcxxxx_dpd_t			dpd;		/**<Deep power-down state */
+	_25lcxxxx_protect_t		prot;		/**<Block protection of device */
+
+	#if ( 1 == _25LCXXXX_CFG_READ_FWD_EN )
+		_25lcxxxx_fwd_t		fwd;		/**<Last programmed data */
+	#endif
+
+	#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+		_25lcxxxx_cache_t	cache;		/**<Read cache */
+	#endif
+
+	#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+		_25lcxxxx_stats_t	stats;		/**<Performance statistics */
+	#endif
+} _25lcxxxx_dev_t;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions Prototypes
 ////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t 		_25lcxxxx_dev_init				(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_dev_cfg_t * const p_cfg);
+_25lcxxxx_status_t 		_25lcxxxx_dev_deinit			(_25lcxxxx_dev_t * const p_dev);
+const bool		   		_25lcxxxx_dev_is_init			(const _25lcxxxx_dev_t * const p_dev);
+_25lcxxxx_status_t 		_25lcxxxx_dev_write				(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+_25lcxxxx_status_t 		_25lcxxxx_dev_write_if_diff		(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+_25lcxxxx_status_t 		_25lcxxxx_dev_writev			(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_seg_t * const p_seg, const uint32_t seg_cnt);
+_25lcxxxx_status_t 		_25lcxxxx_dev_erase				(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size);
+_25lcxxxx_status_t 		_25lcxxxx_dev_read				(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+_25lcxxxx_status_t 		_25lcxxxx_dev_read_stream		(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, pf_25lcxxxx_read_cb_t pf_consumer);
+_25lcxxxx_status_t 		_25lcxxxx_dev_set_protection	(_25lcxxxx_dev_t * const p_dev, const _25lcxxxx_protect_t prot_opt);
+_25lcxxxx_status_t 		_25lcxxxx_dev_write_async		(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_25lcxxxx_async_cb_t pf_done);
+_25lcxxxx_status_t 		_25lcxxxx_dev_process			(_25lcxxxx_dev_t * const p_dev);
+_25lcxxxx_async_state_t _25lcxxxx_dev_get_async_state	(const _25lcxxxx_dev_t * const p_dev);
+_25lcxxxx_status_t 		_25lcxxxx_dev_wait_ready		(_25lcxxxx_dev_t * const p_dev);
+const bool				_25lcxxxx_dev_is_busy			(_25lcxxxx_dev_t * const p_dev);
+_25lcxxxx_status_t 		_25lcxxxx_dev_get_dpd_stats		(const _25lcxxxx_dev_t * const p_dev, _25lcxxxx_dpd_stats_t * const p_stats);
+_25lcxxxx_status_t 		_25lcxxxx_dev_get_geometry		(const _25lcxxxx_dev_t * const p_dev, uint32_t * const p_size, uint16_t * const p_page_size);
+_25lcxxxx_status_t 		_25lcxxxx_dev_get_twc_stats		(const _25lcxxxx_dev_t * const p_dev, _25lcxxxx_twc_stats_t * const p_stats);
+_25lcxxxx_dev_t *		_25lcxxxx_get_dev				(void);
+
+#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+	_25lcxxxx_status_t 	_25lcxxxx_dev_get_stats			(const _25lcxxxx_dev_t * const p_dev, _25lcxxxx_stats_t * const p_stats);
+	_25lcxxxx_status_t 	_25lcxxxx_dev_reset_stats		(_25lcxxxx_dev_t * const p_dev);
+#endif
+
+#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+	_25lcxxxx_status_t 	_25lcxxxx_dev_get_cache_stats	(const _25lcxxxx_dev_t * const p_dev, _25lcxxxx_cache_stats_t * const p_stats);
+	_25lcxxxx_status_t 	_25lcxxxx_dev_reset_cache_stats	(_25lcxxxx_dev_t * const p_dev);
+#endif
+
 _25lcxxxx_status_t _25lcxxxx_init			(void);
 _25lcxxxx_status_t _25lcxxxx_deinit			(void);
 const bool		   _25lcxxxx_is_init		(void);
 _25lcxxxx_status_t _25lcxxxx_write			(const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_write_if_diff	(const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_writev			(const _25lcxxxx_seg_t * const p_seg, const uint32_t seg_cnt);
 _25lcxxxx_status_t _25lcxxxx_erase			(const uint32_t addr, const uint32_t size);
 _25lcxxxx_status_t _25lcxxxx_read			(const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_read_stream	(const uint32_t addr, const uint32_t size, pf_25lcxxxx_read_cb_t pf_consumer);
 _25lcxxxx_status_t _25lcxxxx_set_protection	(const _25lcxxxx_protect_t prot_opt);
 
+_25lcxxxx_status_t 		_25lcxxxx_write_async		(const uint32_t addr, const uint32_t size, const uint8_t * const p_data, pf_25lcxxxx_async_cb_t pf_done);
+_25lcxxxx_status_t 		_25lcxxxx_process			(void);
+_25lcxxxx_async_state_t _25lcxxxx_get_async_state	(void);
+_25lcxxxx_status_t 		_25lcxxxx_wait_ready		(void);
+const bool				_25lcxxxx_is_busy			(void);
+_25lcxxxx_status_t 		_25lcxxxx_get_dpd_stats		(_25lcxxxx_dpd_stats_t * const p_stats);
+_25lcxxxx_status_t 		_25lcxxxx_get_geometry		(uint32_t * const p_size, uint16_t * const p_page_size);
+_25lcxxxx_status_t 		_25lcxxxx_get_twc_stats		(_25lcxxxx_twc_stats_t * const p_stats);
+
+#if ( 1 == _25LCXXXX_CFG_STATS_EN )
+	_25lcxxxx_status_t 	_25lcxxxx_get_stats			(_25lcxxxx_stats_t * const p_stats);
+	_25lcxxxx_status_t 	_25lcxxxx_reset_stats		(void);
+#endif
+
+#if ( _25LCXXXX_CFG_CACHE_SLOT_NUM > 0 )
+	_25lcxxxx_status_t 	_25lcxxxx_get_cache_stats	(_25lcxxxx_cache_stats_t * const p_stats);
+	_25lcxxxx_status_t 	_25lcxxxx_reset_cache_stats	(void);
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
@@ -0,0 +1,431 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_jnl.c
+*@brief     Power fail atomic transactions on 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_JNL
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Write ahead (redo) journal on top of 25LCxxxx API
+*
+* 	Writes of transaction are staged in RAM as journal record. On commit
+* 	whole record (header with CRC-16 and all staged writes) is written to
+* 	journal region of device in one write, which is commit point. Only then
+* 	staged writes are applied to their target addresses. Applied record
+* 	is invalidated by clearing its magic byte, so commit costs programs
+* 	of journal record (one page for small transactions) plus one more
+* 	write cycle.
+*
+* 	On device initialization valid journal record is replayed. Replay uses
+* 	write of changed data only, so already applied transaction costs only
+* 	reads and recovery time is bounded by journal region size.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "25lcxxxx_jnl.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Journal record magic
+ */
+#define _25LCXXXX_JNL_MAGIC					( 0xA5U )
+
+/**
+ * 	Magic of applied journal record
+ */
+#define _25LCXXXX_JNL_MAGIC_DONE			( 0x00U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t 			_25lcxxxx_jnl_crc16			(uint16_t crc, const uint8_t * const p_data, const uint32_t size);
+static _25lcxxxx_status_t	_25lcxxxx_jnl_replay		(_25lcxxxx_dev_t * const p_dev, const uint32_t payload_size);
+static _25lcxxxx_status_t	_25lcxxxx_jnl_retire		(_25lcxxxx_dev_t * const p_dev);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Begin transaction
+*
+* @param[in]	p_jnl	- Pointer to transaction context
+* @param[in]	p_dev	- Pointer to initialized device with journal region
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_jnl_begin(_25lcxxxx_jnl_t * const p_jnl, _25lcxxxx_dev_t * const p_dev)
+{
+	_25LCXXXX_ASSERT( NULL != p_jnl );
+	_25LCXXXX_ASSERT( NULL != p_dev );
+	_25LCXXXX_ASSERT( true == _25lcxxxx_dev_is_init( p_dev ));
+
+	// Journal region must be configured and fit into record image
+	_25LCXXXX_ASSERT( p_dev->cfg.jnl_size > _25LCXXXX_JNL_HDR_SIZE );
+	_25LCXXXX_ASSERT( p_dev->cfg.jnl_size <= _25LCXXXX_CFG_JNL_SIZE );
+
+	p_jnl->p_dev 	= p_dev;
+	p_jnl->size		= _25LCXXXX_JNL_HDR_SIZE;
+	p_jnl->is_open	= true;
+
+	return e25LCXXXX_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Stage write into transaction
+*
+* @note		Nothing is written to device until commit. Reads return old
+* 			data until then.
+*
+* @param[in]	p_jnl	- Pointer to transaction context
+* @param[in]	addr	- Start address of write
+* @param[in]	size	- Size of bytes to write
+* @param[in]	p_data	- Pointer to write data
+* @return 		status 	- Status of operation, error if journal is full
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_jnl_stage(_25lcxxxx_jnl_t * const p_jnl, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	_25LCXXXX_ASSERT( NULL != p_jnl );
+	_25LCXXXX_ASSERT( true == p_jnl->is_open );
+	_25LCXXXX_ASSERT( NULL != p_data );
+	_25LCXXXX_ASSERT(( size > 0UL ) && ( size <= 0xFFFFUL ));
+	_25LCXXXX_ASSERT(( addr + size - 1UL ) <= p_jnl->p_dev->max_addr );
+
+	// Target must be outside of journal region
+	_25LCXXXX_ASSERT(	(( addr + size ) <= p_jnl->p_dev->cfg.jnl_addr )
+					||	( addr >= ( p_jnl->p_dev->cfg.jnl_addr + p_jnl->p_dev->cfg.jnl_size )));
+
+	if (( p_jnl->size + _25LCXXXX_JNL_ENTRY_HDR_SIZE + size ) > p_jnl->p_dev->cfg.jnl_size )
+	{
+		status = e25LCXXXX_ERROR;
+	}
+	else
+	{
+		uint8_t * const p_entry = &p_jnl->buf[ p_jnl->size ];
+
+		p_entry[0] = (uint8_t) ( addr & 0xFFU );
+		p_entry[1] = (uint8_t) (( addr >> 8U ) & 0xFFU );
+		p_entry[2] = (uint8_t) (( addr >> 16U ) & 0xFFU );
+		p_entry[3] = (uint8_t) ( size & 0xFFU );
+		p_entry[4] = (uint8_t) (( size >> 8U ) & 0xFFU );
+
+		memcpy( &p_entry[ _25LCXXXX_JNL_ENTRY_HDR_SIZE ], p_data, size );
+
+		p_jnl->size += ( _25LCXXXX_JNL_ENTRY_HDR_SIZE + size );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Commit transaction
+*
+* @brief	Journal record is written first, then staged writes are applied.
+* 			If reset happens before journal record is completely written
+* 			none of staged writes take effect, afterwards all of them do
+* 			(completed at next device initialization). Journal record is
+* 			invalidated after all staged writes are applied, which takes
+* 			one additional write cycle.
+*
+* @param[in]	p_jnl	- Pointer to transaction context
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_jnl_commit(_25lcxxxx_jnl_t * const p_jnl)
+{
+	_25lcxxxx_status_t	status	= e25LCXXXX_OK;
+	uint32_t			offset	= _25LCXXXX_JNL_HDR_SIZE;
+	uint16_t			crc		= 0U;
+
+	_25LCXXXX_ASSERT( NULL != p_jnl );
+	_25LCXXXX_ASSERT( true == p_jnl->is_open );
+
+	// Something staged
+	if ( p_jnl->size > _25LCXXXX_JNL_HDR_SIZE )
+	{
+		const uint32_t payload_size = p_jnl->size - _25LCXXXX_JNL_HDR_SIZE;
+
+		// Assemble header
+		p_jnl->buf[0] = _25LCXXXX_JNL_MAGIC;
+		p_jnl->buf[1] = (uint8_t) ( payload_size & 0xFFU );
+		p_jnl->buf[2] = (uint8_t) (( payload_size >> 8U ) & 0xFFU );
+
+		crc = _25lcxxxx_jnl_crc16( 0xFFFFU, &p_jnl->buf[1], 2UL );
+		crc = _25lcxxxx_jnl_crc16( crc, &p_jnl->buf[ _25LCXXXX_JNL_HDR_SIZE ], payload_size );
+
+		p_jnl->buf[3] = (uint8_t) ( crc & 0xFFU );
+		p_jnl->buf[4] = (uint8_t) ( crc >> 8U );
+
+		// Write journal record - commit point
+		status = _25lcxxxx_dev_write( p_jnl->p_dev, p_jnl->p_dev->cfg.jnl_addr, p_jnl->size, p_jnl->buf );
+
+		// Apply staged writes
+		while (( offset < p_jnl->size ) && ( e25LCXXXX_OK == status ))
+		{
+			const uint8_t * const p_entry = &p_jnl->buf[offset];
+
+			const uint32_t addr = 	((uint32_t) p_entry[0] )
+								|	((uint32_t) p_entry[1] << 8U )
+								|	((uint32_t) p_entry[2] << 16U );
+			const uint32_t size = 	((uint32_t) p_entry[3] )
+								|	((uint32_t) p_entry[4] << 8U );
+
+			status = _25lcxxxx_dev_write( p_jnl->p_dev, addr, size, &p_entry[ _25LCXXXX_JNL_ENTRY_HDR_SIZE ] );
+
+			offset += ( _25LCXXXX_JNL_ENTRY_HDR_SIZE + size );
+		}
+
+		// Transaction done
+		if ( e25LCXXXX_OK == status )
+		{
+			status = _25lcxxxx_jnl_retire( p_jnl->p_dev );
+		}
+	}
+
+	p_jnl->is_open = false;
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Abort transaction
+*
+* @note		Staged writes are discarded, device is not touched.
+*
+* @param[in]	p_jnl	- Pointer to transaction context
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_jnl_abort(_25lcxxxx_jnl_t * const p_jnl)
+{
+	_25LCXXXX_ASSERT( NULL != p_jnl );
+
+	p_jnl->size 	= _25LCXXXX_JNL_HDR_SIZE;
+	p_jnl->is_open 	= false;
+
+	return e25LCXXXX_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Recover interrupted transaction
+*
+* @note		Called from device initialization when journal region is
+* 			configured. Journal record is validated and replayed, which
+* 			takes at most one pass over journal region.
+*
+* @param[in]	p_dev	- Pointer to initialized device
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_jnl_recover(_25lcxxxx_dev_t * const p_dev)
+{
+	_25lcxxxx_status_t	status			= e25LCXXXX_OK;
+	uint32_t			payload_size	= 0UL;
+	uint32_t			offset			= 0UL;
+	uint16_t			crc				= 0U;
+	uint8_t				hdr[ _25LCXXXX_JNL_HDR_SIZE ];
+	uint8_t				buf[ _25LCXXXX_CFG_PAGE_SIZE_BYTE ];
+
+	_25LCXXXX_ASSERT( NULL != p_dev );
+	_25LCXXXX_ASSERT( true == _25lcxxxx_dev_is_init( p_dev ));
+	_25LCXXXX_ASSERT( p_dev->cfg.page_size <= _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+
+	// No journal
+	if ( p_dev->cfg.jnl_size <= _25LCXXXX_JNL_HDR_SIZE )
+	{
+		return e25LCXXXX_OK;
+	}
+
+	status = _25lcxxxx_dev_read( p_dev, p_dev->cfg.jnl_addr, _25LCXXXX_JNL_HDR_SIZE, hdr );
+
+	payload_size = ((uint32_t) hdr[1] ) | ((uint32_t) hdr[2] << 8U );
+
+	if (	( e25LCXXXX_OK == status )
+		&&	( _25LCXXXX_JNL_MAGIC == hdr[0] )
+		&&	( payload_size > 0UL )
+		&&	( payload_size <= ( p_dev->cfg.jnl_size - _25LCXXXX_JNL_HDR_SIZE )))
+	{
+		// Validate record in page sized chunks
+		crc = _25lcxxxx_jnl_crc16( 0xFFFFU, &hdr[1], 2UL );
+
+		while (( offset < payload_size ) && ( e25LCXXXX_OK == status ))
+		{
+			const uint32_t chunk = (( payload_size - offset ) > p_dev->cfg.page_size ) ? p_dev->cfg.page_size : ( payload_size - offset );
+
+			status = _25lcxxxx_dev_read( p_dev, ( p_dev->cfg.jnl_addr + _25LCXXXX_JNL_HDR_SIZE + offset ), chunk, buf );
+
+			crc = _25lcxxxx_jnl_crc16( crc, buf, chunk );
+			offset += chunk;
+		}
+
+		// Complete transaction
+		if (	( e25LCXXXX_OK == status )
+			&&	( crc == (uint16_t) ( hdr[3] | ((uint16_t) hdr[4] << 8U ))))
+		{
+			status = _25lcxxxx_jnl_replay( p_dev, payload_size );
+
+			if ( e25LCXXXX_OK == status )
+			{
+				status = _25lcxxxx_jnl_retire( p_dev );
+			}
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_JNL_KERNEL
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Kernel functions of journal
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate CRC-16 (CCITT, poly 0x1021)
+*
+* @param[in]	crc		- Initial/previous CRC value
+* @param[in]	p_data	- Pointer to data
+* @param[in]	size	- Size of data
+* @return 		crc 	- Calculated CRC
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t _25lcxxxx_jnl_crc16(uint16_t crc, const uint8_t * const p_data, const uint32_t size)
+{
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		crc ^= (uint16_t) ((uint16_t) p_data[i] << 8U );
+
+		for ( uint8_t b = 0; b < 8U; b++ )
+		{
+			if ( crc & 0x8000U )
+			{
+				crc = (uint16_t) (( crc << 1U ) ^ 0x1021U );
+			}
+			else
+			{
+				crc = (uint16_t) ( crc << 1U );
+			}
+		}
+	}
+
+	return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Replay validated journal record
+*
+* @note		Data is copied from journal to targets in page sized chunks
+* 			and only changed bytes are programmed.
+*
+* @param[in]	p_dev			- Pointer to device context
+* @param[in]	payload_size	- Size of journal record entries
+* @return 		status 			- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_jnl_replay(_25lcxxxx_dev_t * const p_dev, const uint32_t payload_size)
+{
+	_25lcxxxx_status_t	status	= e25LCXXXX_OK;
+	uint32_t			offset	= 0UL;
+	uint8_t				entry[ _25LCXXXX_JNL_ENTRY_HDR_SIZE ];
+	uint8_t				buf[ _25LCXXXX_CFG_PAGE_SIZE_BYTE ];
+
+	const uint32_t payload_addr = p_dev->cfg.jnl_addr + _25LCXXXX_JNL_HDR_SIZE;
+
+	while (	(( offset + _25LCXXXX_JNL_ENTRY_HDR_SIZE ) < payload_size )
+		&&	( e25LCXXXX_OK == status ))
+	{
+		status = _25lcxxxx_dev_read( p_dev, ( payload_addr + offset ), _25LCXXXX_JNL_ENTRY_HDR_SIZE, entry );
+
+		const uint32_t addr = 	((uint32_t) entry[0] )
+							|	((uint32_t) entry[1] << 8U )
+							|	((uint32_t) entry[2] << 16U );
+		const uint32_t size = 	((uint32_t) entry[3] )
+							|	((uint32_t) entry[4] << 8U );
+
+		offset += _25LCXXXX_JNL_ENTRY_HDR_SIZE;
+
+		// Corrupted entry
+		if (	( size > ( payload_size - offset ))
+			||	(( addr + size - 1UL ) > p_dev->max_addr ))
+		{
+			status = e25LCXXXX_ERROR;
+		}
+
+		for ( uint32_t pos = 0UL; ( pos < size ) && ( e25LCXXXX_OK == status ); )
+		{
+			const uint32_t chunk = (( size - pos ) > p_dev->cfg.page_size ) ? p_dev->cfg.page_size : ( size - pos );
+
+			status = _25lcxxxx_dev_read( p_dev, ( payload_addr + offset + pos ), chunk, buf );
+
+			if ( e25LCXXXX_OK == status )
+			{
+				status = _25lcxxxx_dev_write_if_diff( p_dev, ( addr + pos ), chunk, buf );
+			}
+
+			pos += chunk;
+		}
+
+		offset += size;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Invalidate applied journal record
+*
+* @note		Reset before magic byte is cleared only replays already
+* 			applied data again.
+*
+* @param[in]	p_dev	- Pointer to device context
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_jnl_retire(_25lcxxxx_dev_t * const p_dev)
+{
+	const uint8_t magic = _25LCXXXX_JNL_MAGIC_DONE;
+
+	return _25lcxxxx_dev_write( p_dev, p_dev->cfg.jnl_addr, 1UL, &magic );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
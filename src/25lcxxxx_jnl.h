@@ -0,0 +1,77 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_jnl.h
+*@brief    	Power fail atomic transactions on 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_JNL
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _25LCXXXX_JNL_H_
+#define _25LCXXXX_JNL_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "25lcxxxx.h"
+#include "../../25lcxxxx_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Size of journal header
+ *
+ * 	Magic (1), payload size (2) and CRC-16 (2)
+ *
+ * 	Unit: bytes
+ */
+#define _25LCXXXX_JNL_HDR_SIZE				( 5UL )
+
+/**
+ * 	Size of staged write entry header
+ *
+ * 	Target address (3) and data size (2)
+ *
+ * 	Unit: bytes
+ */
+#define _25LCXXXX_JNL_ENTRY_HDR_SIZE		( 5UL )
+
+/**
+ * 	Transaction context
+ */
+typedef struct
+{
+	_25lcxxxx_dev_t *	p_dev;									/**<Underlying device */
+	uint32_t			size;									/**<Size of journal record (header & entries) */
+	uint8_t				buf[_25LCXXXX_CFG_JNL_SIZE];			/**<Journal record image */
+	bool				is_open;								/**<Transaction started */
+} _25lcxxxx_jnl_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_jnl_begin		(_25lcxxxx_jnl_t * const p_jnl, _25lcxxxx_dev_t * const p_dev);
+_25lcxxxx_status_t _25lcxxxx_jnl_stage		(_25lcxxxx_jnl_t * const p_jnl, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_jnl_commit		(_25lcxxxx_jnl_t * const p_jnl);
+_25lcxxxx_status_t _25lcxxxx_jnl_abort		(_25lcxxxx_jnl_t * const p_jnl);
+_25lcxxxx_status_t _25lcxxxx_jnl_recover	(_25lcxxxx_dev_t * const p_dev);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // _25LCXXXX_JNL_H_
@@ -0,0 +1,639 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_kv.c
+*@brief     Wear leveled key-value store on 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_KV
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Log structured key-value store on top of 25LCxxxx API
+*
+* 	Store region is used as circular log of pages. Each update appends new
+* 	record (key, length, sequence number, CRC-16 and data) at head of log,
+* 	which costs single page program. Records never cross page boundary.
+*
+* 	When head moves to next page, live records of page after it are copied
+* 	into new head page within same program. This keeps one free page in
+* 	front of head and spreads wear over whole region.
+*
+* 	At initialization region is scanned from oldest to newest page and RAM
+* 	index of latest record address per key is built, so lookups are O(1).
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "25lcxxxx_kv.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Unused index entry
+ */
+#define _25LCXXXX_KV_INDEX_NONE				( 0xFFFFFFFFUL )
+
+/**
+ * 	Key of empty (not programmed) space
+ */
+#define _25LCXXXX_KV_KEY_EMPTY				( 0xFFFFU )
+
+/**
+ * 	Maximum number of records in single page
+ */
+#define _25LCXXXX_KV_REC_PER_PAGE_MAX		( _25LCXXXX_CFG_PAGE_SIZE_BYTE / ( _25LCXXXX_KV_HDR_SIZE + 1UL ))
+
+/**
+ * 	Minimum number of pages in store region
+ */
+#define _25LCXXXX_KV_PAGE_NUM_MIN			( 3UL )
+
+/**
+ * 	Build/extract index entry
+ */
+#define _25LCXXXX_KV_ENTRY(addr,len)		((uint32_t)((( addr ) << 8U ) | (( len ) & 0xFFU )))
+#define _25LCXXXX_KV_ENTRY_ADDR(entry)		((uint32_t)(( entry ) >> 8U ))
+#define _25LCXXXX_KV_ENTRY_LEN(entry)		((uint32_t)(( entry ) & 0xFFU ))
+
+/**
+ * 	Record header fields
+ */
+typedef struct
+{
+	uint16_t	key;	/**<Key */
+	uint8_t		len;	/**<Data length */
+	uint32_t	seq;	/**<Sequence number */
+} _25lcxxxx_kv_hdr_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t 			_25lcxxxx_kv_crc16				(uint16_t crc, const uint8_t * const p_data, const uint32_t size);
+static uint32_t 			_25lcxxxx_kv_page_addr			(const _25lcxxxx_kv_t * const p_kv, const uint32_t page);
+static bool 				_25lcxxxx_kv_parse_record		(const uint8_t * const p_buf, const uint32_t offset, const uint32_t page_size, _25lcxxxx_kv_hdr_t * const p_hdr);
+static uint32_t 			_25lcxxxx_kv_put_record			(uint8_t * const p_buf, const uint16_t key, const uint32_t seq, const uint8_t * const p_data, const uint32_t size);
+static _25lcxxxx_status_t 	_25lcxxxx_kv_read_page			(_25lcxxxx_kv_t * const p_kv, const uint32_t page, uint8_t * const p_buf);
+static _25lcxxxx_status_t 	_25lcxxxx_kv_open_page			(_25lcxxxx_kv_t * const p_kv, const uint16_t key, const uint8_t * const p_data, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize (mount) key-value store
+*
+* @note		Blank region (all 0xFF) is valid empty store. Region holding
+* 			other data shall be formatted first.
+*
+* @param[in]	p_kv	- Pointer to key-value store context
+* @param[in]	p_dev	- Pointer to initialized device
+* @param[in]	start	- Start address of store region, page aligned
+* @param[in]	size	- Size of store region, multiple of page size
+* @return 		status 	- Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_kv_init(_25lcxxxx_kv_t * const p_kv, _25lcxxxx_dev_t * const p_dev, const uint32_t start, const uint32_t size)
+{
+	_25lcxxxx_status_t	status		= e25LCXXXX_OK;
+	_25lcxxxx_kv_hdr_t	hdr			= { 0 };
+	uint32_t			max_seq		= 0UL;
+	bool				is_empty	= true;
+	uint8_t				buf[ _25LCXXXX_CFG_PAGE_SIZE_BYTE ];
+
+	_25LCXXXX_ASSERT( NULL != p_kv );
+	_25LCXXXX_ASSERT( NULL != p_dev );
+	_25LCXXXX_ASSERT( true == _25lcxxxx_dev_is_init( p_dev ));
+	_25LCXXXX_ASSERT( p_dev->cfg.page_size <= _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+
+	// Region must be page aligned
+	_25LCXXXX_ASSERT( 0UL == ( start & p_dev->page_mask ));
+	_25LCXXXX_ASSERT( 0UL == ( size & p_dev->page_mask ));
+	_25LCXXXX_ASSERT(( start + size - 1UL ) <= p_dev->max_addr );
+
+	p_kv->p_dev 		= p_dev;
+	p_kv->start 		= start;
+	p_kv->page_num		= size / p_dev->cfg.page_size;
+	p_kv->is_init		= false;
+
+	_25LCXXXX_ASSERT( p_kv->page_num >= _25LCXXXX_KV_PAGE_NUM_MIN );
+
+	for ( uint32_t k = 0; k < _25LCXXXX_CFG_KV_KEY_NUM; k++ )
+	{
+		p_kv->index[k] = _25LCXXXX_KV_INDEX_NONE;
+	}
+
+	// Find head page - page with newest first record
+	for ( uint32_t page = 0; ( page < p_kv->page_num ) && ( e25LCXXXX_OK == status ); page++ )
+	{
+		status = _25lcxxxx_kv_read_page( p_kv, page, buf );
+
+		if (	( e25LCXXXX_OK == status )
+			&&	( true == _25lcxxxx_kv_parse_record( buf, 0UL, p_dev->cfg.page_size, &hdr )))
+		{
+			if (( true == is_empty ) || ( hdr.seq > max_seq ))
+			{
+				max_seq 		= hdr.seq;
+				p_kv->head_page	= page;
+				is_empty		= false;
+			}
+		}
+	}
+
+	if ( true == is_empty )
+	{
+		// Next append opens first page
+		p_kv->head_page 	= p_kv->page_num - 1UL;
+		p_kv->head_offset 	= p_dev->cfg.page_size;
+		p_kv->seq			= 1UL;
+	}
+	else
+	{
+		// Scan from oldest to newest page, newer records override older ones
+		for ( uint32_t i = 1; ( i <= p_kv->page_num ) && ( e25LCXXXX_OK == status ); i++ )
+		{
+			const uint32_t page 	= ( p_kv->head_page + i ) % p_kv->page_num;
+			uint32_t		offset	= 0UL;
+
+			status = _25lcxxxx_kv_read_page( p_kv, page, buf );
+
+			while (	( e25LCXXXX_OK == status )
+				&&	( true == _25lcxxxx_kv_parse_record( buf, offset, p_dev->cfg.page_size, &hdr )))
+			{
+				if ( hdr.key < _25LCXXXX_CFG_KV_KEY_NUM )
+				{
+					p_kv->index[hdr.key] = _25LCXXXX_KV_ENTRY( _25lcxxxx_kv_page_addr( p_kv, page ) + offset, hdr.len );
+				}
+
+				if ( hdr.seq > max_seq )
+				{
+					max_seq = hdr.seq;
+				}
+
+				offset += ( _25LCXXXX_KV_HDR_SIZE + hdr.len );
+			}
+
+			// Free space of head page starts after its last record
+			if ( page == p_kv->head_page )
+			{
+				p_kv->head_offset = offset;
+			}
+		}
+
+		p_kv->seq = max_seq + 1UL;
+	}
+
+	if ( e25LCXXXX_OK == status )
+	{
+		p_kv->is_init = true;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Format key-value store
+*
+* @note		Whole store region is erased to 0xFF and all keys are removed.
+*
+* @param[in]	p_kv	- Pointer to key-value store context
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_kv_format(_25lcxxxx_kv_t * const p_kv)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	_25LCXXXX_ASSERT( NULL != p_kv );
+	_25LCXXXX_ASSERT( NULL != p_kv->p_dev );
+
+	const uint32_t page_size = p_kv->p_dev->cfg.page_size;
+
+	memset( p_kv->image, 0xFF, page_size );
+
+	for ( uint32_t page = 0; ( page < p_kv->page_num ) && ( e25LCXXXX_OK == status ); page++ )
+	{
+		status = _25lcxxxx_dev_write( p_kv->p_dev, _25lcxxxx_kv_page_addr( p_kv, page ), page_size, p_kv->image );
+	}
+
+	if ( e25LCXXXX_OK == status )
+	{
+		for ( uint32_t k = 0; k < _25LCXXXX_CFG_KV_KEY_NUM; k++ )
+		{
+			p_kv->index[k] = _25LCXXXX_KV_INDEX_NONE;
+		}
+
+		p_kv->head_page 	= p_kv->page_num - 1UL;
+		p_kv->head_offset 	= page_size;
+		p_kv->seq			= 1UL;
+		p_kv->is_init		= true;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Set value of key
+*
+* @note		Maximum size of value is page size minus "_25LCXXXX_KV_HDR_SIZE".
+*
+* @param[in]	p_kv	- Pointer to key-value store context
+* @param[in]	key		- Key, less than "_25LCXXXX_CFG_KV_KEY_NUM"
+* @param[in]	p_data	- Pointer to value
+* @param[in]	size	- Size of value
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_kv_set(_25lcxxxx_kv_t * const p_kv, const uint16_t key, const uint8_t * const p_data, const uint32_t size)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	_25LCXXXX_ASSERT( NULL != p_kv );
+	_25LCXXXX_ASSERT( true == p_kv->is_init );
+	_25LCXXXX_ASSERT( key < _25LCXXXX_CFG_KV_KEY_NUM );
+	_25LCXXXX_ASSERT( NULL != p_data );
+	_25LCXXXX_ASSERT(( size > 0UL ) && ( size <= 0xFFUL ));
+	_25LCXXXX_ASSERT(( _25LCXXXX_KV_HDR_SIZE + size ) <= p_kv->p_dev->cfg.page_size );
+
+	const uint32_t rec_size = _25LCXXXX_KV_HDR_SIZE + size;
+
+	// Fits into head page
+	if (( p_kv->head_offset + rec_size ) <= p_kv->p_dev->cfg.page_size )
+	{
+		const uint32_t addr = _25lcxxxx_kv_page_addr( p_kv, p_kv->head_page ) + p_kv->head_offset;
+
+		(void) _25lcxxxx_kv_put_record( p_kv->image, key, p_kv->seq, p_data, size );
+
+		status = _25lcxxxx_dev_write( p_kv->p_dev, addr, rec_size, p_kv->image );
+
+		if ( e25LCXXXX_OK == status )
+		{
+			p_kv->index[key] 	= _25LCXXXX_KV_ENTRY( addr, size );
+			p_kv->head_offset 	+= rec_size;
+			p_kv->seq++;
+		}
+	}
+
+	// Move to next page
+	else
+	{
+		status = _25lcxxxx_kv_open_page( p_kv, key, p_data, size );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get value of key
+*
+* @param[in]	p_kv	- Pointer to key-value store context
+* @param[in]	key		- Key, less than "_25LCXXXX_CFG_KV_KEY_NUM"
+* @param[out]	p_data	- Pointer to value buffer
+* @param[in]	size	- Size of value buffer
+* @param[out]	p_len	- Size of stored value, can be NULL
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_kv_get(_25lcxxxx_kv_t * const p_kv, const uint16_t key, uint8_t * const p_data, const uint32_t size, uint32_t * const p_len)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	_25LCXXXX_ASSERT( NULL != p_kv );
+	_25LCXXXX_ASSERT( true == p_kv->is_init );
+	_25LCXXXX_ASSERT( key < _25LCXXXX_CFG_KV_KEY_NUM );
+	_25LCXXXX_ASSERT( NULL != p_data );
+
+	const uint32_t entry = p_kv->index[key];
+
+	// Key not found or value does not fit into buffer
+	if (	( _25LCXXXX_KV_INDEX_NONE == entry )
+		||	( _25LCXXXX_KV_ENTRY_LEN( entry ) > size ))
+	{
+		status = e25LCXXXX_ERROR;
+	}
+	else
+	{
+		status = _25lcxxxx_dev_read( p_kv->p_dev, ( _25LCXXXX_KV_ENTRY_ADDR( entry ) + _25LCXXXX_KV_HDR_SIZE ), _25LCXXXX_KV_ENTRY_LEN( entry ), p_data );
+
+		if ( NULL != p_len )
+		{
+			*p_len = _25LCXXXX_KV_ENTRY_LEN( entry );
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check if key is stored
+*
+* @param[in]	p_kv	- Pointer to key-value store context
+* @param[in]	key		- Key, less than "_25LCXXXX_CFG_KV_KEY_NUM"
+* @return 		exist 	- True if key has value
+*/
+////////////////////////////////////////////////////////////////////////////////
+const bool _25lcxxxx_kv_exist(const _25lcxxxx_kv_t * const p_kv, const uint16_t key)
+{
+	_25LCXXXX_ASSERT( NULL != p_kv );
+	_25LCXXXX_ASSERT( key < _25LCXXXX_CFG_KV_KEY_NUM );
+
+	return (const bool) ( _25LCXXXX_KV_INDEX_NONE != p_kv->index[key] );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_KV_KERNEL
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Kernel functions of key-value store
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Calculate CRC-16 (CCITT, poly 0x1021)
+*
+* @param[in]	crc		- Initial/previous CRC value
+* @param[in]	p_data	- Pointer to data
+* @param[in]	size	- Size of data
+* @return 		crc 	- Calculated CRC
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t _25lcxxxx_kv_crc16(uint16_t crc, const uint8_t * const p_data, const uint32_t size)
+{
+	for ( uint32_t i = 0; i < size; i++ )
+	{
+		crc ^= (uint16_t) ((uint16_t) p_data[i] << 8U );
+
+		for ( uint8_t b = 0; b < 8U; b++ )
+		{
+			if ( crc & 0x8000U )
+			{
+				crc = (uint16_t) (( crc << 1U ) ^ 0x1021U );
+			}
+			else
+			{
+				crc = (uint16_t) ( crc << 1U );
+			}
+		}
+	}
+
+	return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get start address of store page
+*
+* @param[in]	p_kv	- Pointer to key-value store context
+* @param[in]	page	- Page index inside store region
+* @return 		addr 	- Device address of page
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t _25lcxxxx_kv_page_addr(const _25lcxxxx_kv_t * const p_kv, const uint32_t page)
+{
+	return ( p_kv->start + ( page * p_kv->p_dev->cfg.page_size ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Parse and validate record
+*
+* @param[in]	p_buf		- Pointer to page buffer
+* @param[in]	offset		- Offset of record in page
+* @param[in]	page_size	- Size of page
+* @param[out]	p_hdr		- Pointer to parsed header
+* @return 		valid 		- True if valid record is found
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool _25lcxxxx_kv_parse_record(const uint8_t * const p_buf, const uint32_t offset, const uint32_t page_size, _25lcxxxx_kv_hdr_t * const p_hdr)
+{
+	bool valid = false;
+
+	if (( offset + _25LCXXXX_KV_HDR_SIZE ) < page_size )
+	{
+		const uint8_t * const p_rec = &p_buf[offset];
+
+		p_hdr->key 	= (uint16_t) ( p_rec[0] | ((uint16_t) p_rec[1] << 8U ));
+		p_hdr->len 	= p_rec[2];
+		p_hdr->seq 	= 	((uint32_t) p_rec[3] )
+					| 	((uint32_t) p_rec[4] << 8U )
+					| 	((uint32_t) p_rec[5] << 16U )
+					| 	((uint32_t) p_rec[6] << 24U );
+
+		const uint16_t crc = (uint16_t) ( p_rec[7] | ((uint16_t) p_rec[8] << 8U ));
+
+		if (	( _25LCXXXX_KV_KEY_EMPTY != p_hdr->key )
+			&&	( p_hdr->len > 0U )
+			&&	(( offset + _25LCXXXX_KV_HDR_SIZE + p_hdr->len ) <= page_size ))
+		{
+			uint16_t calc_crc = _25lcxxxx_kv_crc16( 0xFFFFU, p_rec, 7UL );
+			calc_crc = _25lcxxxx_kv_crc16( calc_crc, &p_rec[ _25LCXXXX_KV_HDR_SIZE ], p_hdr->len );
+
+			valid = ( calc_crc == crc );
+		}
+	}
+
+	return valid;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Serialize record into buffer
+*
+* @param[out]	p_buf		- Pointer to record destination
+* @param[in]	key			- Key
+* @param[in]	seq			- Sequence number
+* @param[in]	p_data		- Pointer to value
+* @param[in]	size		- Size of value
+* @return 		rec_size	- Size of record
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t _25lcxxxx_kv_put_record(uint8_t * const p_buf, const uint16_t key, const uint32_t seq, const uint8_t * const p_data, const uint32_t size)
+{
+	uint16_t crc = 0U;
+
+	p_buf[0] = (uint8_t) ( key & 0xFFU );
+	p_buf[1] = (uint8_t) ( key >> 8U );
+	p_buf[2] = (uint8_t) size;
+	p_buf[3] = (uint8_t) ( seq & 0xFFU );
+	p_buf[4] = (uint8_t) (( seq >> 8U ) & 0xFFU );
+	p_buf[5] = (uint8_t) (( seq >> 16U ) & 0xFFU );
+	p_buf[6] = (uint8_t) (( seq >> 24U ) & 0xFFU );
+
+	// NOTE: Data may already be in place when relocating record
+	if ( &p_buf[ _25LCXXXX_KV_HDR_SIZE ] != p_data )
+	{
+		memmove( &p_buf[ _25LCXXXX_KV_HDR_SIZE ], p_data, size );
+	}
+
+	crc = _25lcxxxx_kv_crc16( 0xFFFFU, p_buf, 7UL );
+	crc = _25lcxxxx_kv_crc16( crc, &p_buf[ _25LCXXXX_KV_HDR_SIZE ], size );
+
+	p_buf[7] = (uint8_t) ( crc & 0xFFU );
+	p_buf[8] = (uint8_t) ( crc >> 8U );
+
+	return ( _25LCXXXX_KV_HDR_SIZE + size );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read store page
+*
+* @param[in]	p_kv	- Pointer to key-value store context
+* @param[in]	page	- Page index inside store region
+* @param[out]	p_buf	- Pointer to page buffer
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_kv_read_page(_25lcxxxx_kv_t * const p_kv, const uint32_t page, uint8_t * const p_buf)
+{
+	return _25lcxxxx_dev_read( p_kv->p_dev, _25lcxxxx_kv_page_addr( p_kv, page ), p_kv->p_dev->cfg.page_size, p_buf );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Open next page and append record to it
+*
+*	Live records of page after new head page are copied into it first, so
+*	that page in front of head is free. If new record does not fit any more
+*	procedure is repeated on following page.
+*
+* @param[in]	p_kv	- Pointer to key-value store context
+* @param[in]	key		- Key
+* @param[in]	p_data	- Pointer to value
+* @param[in]	size	- Size of value
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_kv_open_page(_25lcxxxx_kv_t * const p_kv, const uint16_t key, const uint8_t * const p_data, const uint32_t size)
+{
+	_25lcxxxx_status_t	status		= e25LCXXXX_ERROR;
+
+	// Relocated records and new record
+	uint16_t			rel_key[ _25LCXXXX_KV_REC_PER_PAGE_MAX + 1UL ];
+	uint32_t			rel_entry[ _25LCXXXX_KV_REC_PER_PAGE_MAX + 1UL ];
+
+	uint8_t				buf[ _25LCXXXX_CFG_PAGE_SIZE_BYTE ];
+
+	const uint32_t page_size 	= p_kv->p_dev->cfg.page_size;
+	bool			is_done		= false;
+
+	for ( uint32_t tries = 0; ( tries < p_kv->page_num ) && ( false == is_done ); tries++ )
+	{
+		const uint32_t	page 		= ( p_kv->head_page + 1UL ) % p_kv->page_num;
+		const uint32_t	page_addr 	= _25lcxxxx_kv_page_addr( p_kv, page );
+		uint32_t		offset		= 0UL;
+		uint32_t		rel_num		= 0UL;
+
+		status = e25LCXXXX_OK;
+		memset( p_kv->image, 0xFF, page_size );
+
+		// Collect live records of new head page (only after interrupted
+		// relocation) and of page in front of it
+		for ( uint32_t src = 0; ( src < 2UL ) && ( e25LCXXXX_OK == status ); src++ )
+		{
+			const uint32_t src_addr = _25lcxxxx_kv_page_addr( p_kv, (( page + src ) % p_kv->page_num ));
+			bool			is_read	= false;
+
+			for ( uint32_t k = 0; ( k < _25LCXXXX_CFG_KV_KEY_NUM ) && ( e25LCXXXX_OK == status ); k++ )
+			{
+				const uint32_t entry = p_kv->index[k];
+
+				if (	( _25LCXXXX_KV_INDEX_NONE != entry )
+					&&	( _25LCXXXX_KV_ENTRY_ADDR( entry ) >= src_addr )
+					&&	( _25LCXXXX_KV_ENTRY_ADDR( entry ) < ( src_addr + page_size )))
+				{
+					const uint32_t len = _25LCXXXX_KV_ENTRY_LEN( entry );
+
+					if ( false == is_read )
+					{
+						status 	= _25lcxxxx_kv_read_page( p_kv, (( page + src ) % p_kv->page_num ), buf );
+						is_read	= true;
+					}
+
+					if (	( e25LCXXXX_OK == status )
+						&&	(( offset + _25LCXXXX_KV_HDR_SIZE + len ) <= page_size )
+						&&	( rel_num < _25LCXXXX_KV_REC_PER_PAGE_MAX ))
+					{
+						const uint32_t src_offset = _25LCXXXX_KV_ENTRY_ADDR( entry ) - src_addr;
+
+						rel_key[rel_num] 	= (uint16_t) k;
+						rel_entry[rel_num] 	= _25LCXXXX_KV_ENTRY( page_addr + offset, len );
+						rel_num++;
+
+						offset += _25lcxxxx_kv_put_record( &p_kv->image[offset], (uint16_t) k, p_kv->seq++, &buf[ src_offset + _25LCXXXX_KV_HDR_SIZE ], len );
+					}
+				}
+			}
+		}
+
+		if ( e25LCXXXX_OK == status )
+		{
+			// Append new record
+			if (( offset + _25LCXXXX_KV_HDR_SIZE + size ) <= page_size )
+			{
+				rel_key[rel_num] 	= key;
+				rel_entry[rel_num] 	= _25LCXXXX_KV_ENTRY( page_addr + offset, size );
+				rel_num++;
+
+				offset += _25lcxxxx_kv_put_record( &p_kv->image[offset], key, p_kv->seq++, p_data, size );
+				is_done = true;
+			}
+
+			// Program whole page at once
+			status = _25lcxxxx_dev_write( p_kv->p_dev, page_addr, page_size, p_kv->image );
+		}
+
+		if ( e25LCXXXX_OK == status )
+		{
+			for ( uint32_t i = 0; i < rel_num; i++ )
+			{
+				p_kv->index[ rel_key[i] ] = rel_entry[i];
+			}
+
+			p_kv->head_page 	= page;
+			p_kv->head_offset 	= offset;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	// Store full
+	if ( false == is_done )
+	{
+		status |= e25LCXXXX_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,73 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_kv.h
+*@brief    	Wear leveled key-value store on 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_KV
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _25LCXXXX_KV_H_
+#define _25LCXXXX_KV_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "25lcxxxx.h"
+#include "../../25lcxxxx_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Size of record header
+ *
+ * 	Key (2), length (1), sequence (4) and CRC-16 (2)
+ *
+ * 	Unit: bytes
+ */
+#define _25LCXXXX_KV_HDR_SIZE				( 9UL )
+
+/**
+ * 	Key-value store context
+ */
+typedef struct
+{
+	_25lcxxxx_dev_t *	p_dev;											/**<Underlying device */
+	uint32_t			start;											/**<Start address of store region */
+	uint32_t			page_num;										/**<Number of pages in store region */
+	uint32_t			head_page;										/**<Page currently being appended */
+	uint32_t			head_offset;									/**<Offset of free space in head page */
+	uint32_t			seq;											/**<Sequence number of next record */
+	uint32_t			index[_25LCXXXX_CFG_KV_KEY_NUM];				/**<Record address (upper 24 bits) & data length (lower 8 bits) by key */
+	uint8_t				image[_25LCXXXX_CFG_PAGE_SIZE_BYTE];			/**<Page image buffer */
+	bool				is_init;										/**<Initialization guard */
+} _25lcxxxx_kv_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_kv_init		(_25lcxxxx_kv_t * const p_kv, _25lcxxxx_dev_t * const p_dev, const uint32_t start, const uint32_t size);
+_25lcxxxx_status_t _25lcxxxx_kv_format		(_25lcxxxx_kv_t * const p_kv);
+_25lcxxxx_status_t _25lcxxxx_kv_set			(_25lcxxxx_kv_t * const p_kv, const uint16_t key, const uint8_t * const p_data, const uint32_t size);
+_25lcxxxx_status_t _25lcxxxx_kv_get			(_25lcxxxx_kv_t * const p_kv, const uint16_t key, uint8_t * const p_data, const uint32_t size, uint32_t * const p_len);
+const bool		   _25lcxxxx_kv_exist		(const _25lcxxxx_kv_t * const p_kv, const uint16_t key);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // _25LCXXXX_KV_H_
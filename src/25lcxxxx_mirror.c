@@ -0,0 +1,501 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_mirror.c
+*@brief     Mirrored volume of two 25LCxxxx EEPROM devices
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_MIRROR
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Mirrored volume on top of 25LCxxxx API
+*
+* 	Each page of volume is kept on both devices at same address. Last
+* 	"_25LCXXXX_MIRROR_CRC_SIZE" bytes of page hold CRC-32 of its data, so
+* 	page of volume carries page size minus checksum of data. Blank page
+* 	(all 0xFF) is valid as well, but copy with matching checksum always
+* 	wins over blank one.
+*
+* 	Page is programmed first to primary and right after to secondary
+* 	device, thus write cycles of both devices overlap. Page interrupted
+* 	on primary device is restored from old secondary copy, page
+* 	interrupted on secondary device from new primary copy.
+*
+* 	Page is read from primary device, or from secondary when primary is
+* 	in write cycle. Copy failing checksum is replaced with other copy.
+*
+* 	@note	Devices shall be accessed only through mirror.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "25lcxxxx_mirror.h"
+#include "25lcxxxx_rec.h"
+#include "../../25lcxxxx_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	State of page copy, ordered from worst to best
+ */
+typedef enum
+{
+	e25LCXXXX_MIRROR_COPY_BAD = 0,		/**<Checksum mismatch */
+	e25LCXXXX_MIRROR_COPY_BLANK,		/**<Page never written (all 0xFF) */
+	e25LCXXXX_MIRROR_COPY_VALID,		/**<Checksum matches */
+} _25lcxxxx_mirror_copy_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t 	_25lcxxxx_mirror_load		(_25lcxxxx_mirror_t * const p_mir, const uint32_t page, uint8_t * const p_buf);
+static _25lcxxxx_status_t 	_25lcxxxx_mirror_program	(_25lcxxxx_mirror_t * const p_mir, const uint32_t page, uint8_t * const p_buf);
+static _25lcxxxx_mirror_copy_t	_25lcxxxx_mirror_check	(const _25lcxxxx_mirror_t * const p_mir, const uint8_t * const p_buf);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize mirrored volume
+*
+* @note		Both devices must be initialized and have same size and page size.
+*
+* @param[in]	p_mir	- Pointer to mirror context
+* @param[in]	p_dev_a	- Pointer to primary device
+* @param[in]	p_dev_b	- Pointer to secondary device
+* @return 		status 	- Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_mirror_init(_25lcxxxx_mirror_t * const p_mir, _25lcxxxx_dev_t * const p_dev_a, _25lcxxxx_dev_t * const p_dev_b)
+{
+	_25lcxxxx_status_t	status		= e25LCXXXX_OK;
+	uint32_t			size_a		= 0UL;
+	uint32_t			size_b		= 0UL;
+	uint16_t			page_a		= 0U;
+	uint16_t			page_b		= 0U;
+
+	_25LCXXXX_ASSERT( NULL != p_mir );
+	_25LCXXXX_ASSERT( NULL != p_dev_a );
+	_25LCXXXX_ASSERT( NULL != p_dev_b );
+	_25LCXXXX_ASSERT( p_dev_a != p_dev_b );
+
+	p_mir->is_init = false;
+
+	if (	( true != _25lcxxxx_dev_is_init( p_dev_a ))
+		||	( true != _25lcxxxx_dev_is_init( p_dev_b )))
+	{
+		status = e25LCXXXX_ERROR_INIT;
+	}
+	else
+	{
+		(void) _25lcxxxx_dev_get_geometry( p_dev_a, &size_a, &page_a );
+		(void) _25lcxxxx_dev_get_geometry( p_dev_b, &size_b, &page_b );
+
+		// Devices must be identical
+		if (( size_a != size_b ) || ( page_a != page_b ))
+		{
+			status = e25LCXXXX_ERROR_INIT;
+		}
+	}
+
+	if ( e25LCXXXX_OK == status )
+	{
+		// Page must fit into buffer
+		_25LCXXXX_ASSERT( page_a <= _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+
+		p_mir->p_dev[0] 	= p_dev_a;
+		p_mir->p_dev[1] 	= p_dev_b;
+		p_mir->page_size 	= page_a;
+		p_mir->payload 		= page_a - _25LCXXXX_MIRROR_CRC_SIZE;
+		p_mir->page_num 	= size_a / page_a;
+		p_mir->size 		= p_mir->page_num * p_mir->payload;
+		p_mir->is_init 		= true;
+
+		memset( &p_mir->stats, 0, sizeof( p_mir->stats ));
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write byte(s) to mirrored volume
+*
+* @note		Pages written only partially are read back first, as checksum
+* 			covers whole page. Page with both copies bad is not partially
+* 			written and returns error.
+*
+* @param[in]	p_mir	- Pointer to mirror context
+* @param[in]	addr	- Start address of write
+* @param[in]	size	- Size of bytes to write
+* @param[in]	p_data	- Pointer to write data
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_mirror_write(_25lcxxxx_mirror_t * const p_mir, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	_25lcxxxx_status_t	status			= e25LCXXXX_OK;
+	uint32_t			working_addr	= addr;
+	uint32_t			working_size	= size;
+	uint32_t			data_offset		= 0UL;
+	uint8_t				page_buf[_25LCXXXX_CFG_PAGE_SIZE_BYTE];
+
+	_25LCXXXX_ASSERT( NULL != p_mir );
+	_25LCXXXX_ASSERT( true == p_mir->is_init );
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT(( addr + size ) <= p_mir->size );
+	_25LCXXXX_ASSERT( NULL != p_data );
+
+	while (( working_size > 0UL ) && ( e25LCXXXX_OK == status ))
+	{
+		const uint32_t page 	= ( working_addr / p_mir->payload );
+		const uint32_t offset 	= ( working_addr % p_mir->payload );
+		const uint32_t chunk 	= (( p_mir->payload - offset ) < working_size ) ? ( p_mir->payload - offset ) : working_size;
+
+		// Keep rest of page
+		if ( chunk < p_mir->payload )
+		{
+			status = _25lcxxxx_mirror_load( p_mir, page, page_buf );
+		}
+
+		if ( e25LCXXXX_OK == status )
+		{
+			memcpy( &page_buf[offset], ( p_data + data_offset ), chunk );
+
+			status = _25lcxxxx_mirror_program( p_mir, page, page_buf );
+		}
+
+		data_offset 	+= chunk;
+		working_addr 	+= chunk;
+		working_size 	-= chunk;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read byte(s) from mirrored volume
+*
+* @note		Whole pages are read for checksum check.
+*
+* @param[in]	p_mir	- Pointer to mirror context
+* @param[in]	addr	- Start address of read
+* @param[in]	size	- Size of bytes to read
+* @param[out]	p_data	- Pointer to read data
+* @return 		status 	- Status of operation, error when both copies of page are bad
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_mirror_read(_25lcxxxx_mirror_t * const p_mir, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+	_25lcxxxx_status_t	status			= e25LCXXXX_OK;
+	uint32_t			working_addr	= addr;
+	uint32_t			working_size	= size;
+	uint32_t			data_offset		= 0UL;
+	uint8_t				page_buf[_25LCXXXX_CFG_PAGE_SIZE_BYTE];
+
+	_25LCXXXX_ASSERT( NULL != p_mir );
+	_25LCXXXX_ASSERT( true == p_mir->is_init );
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT(( addr + size ) <= p_mir->size );
+	_25LCXXXX_ASSERT( NULL != p_data );
+
+	while (( working_size > 0UL ) && ( e25LCXXXX_OK == status ))
+	{
+		const uint32_t page 	= ( working_addr / p_mir->payload );
+		const uint32_t offset 	= ( working_addr % p_mir->payload );
+		const uint32_t chunk 	= (( p_mir->payload - offset ) < working_size ) ? ( p_mir->payload - offset ) : working_size;
+
+		status = _25lcxxxx_mirror_load( p_mir, page, page_buf );
+
+		if ( e25LCXXXX_OK == status )
+		{
+			memcpy(( p_data + data_offset ), &page_buf[offset], chunk );
+		}
+
+		data_offset 	+= chunk;
+		working_addr 	+= chunk;
+		working_size 	-= chunk;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check and repair both copies of all pages
+*
+* @brief	Bad copy is replaced by good one and blank copy by one with
+* 			valid checksum. When both copies have valid checksum but
+* 			differ (write interrupted between devices) primary copy is
+* 			taken. Intended to run at start-up.
+*
+* @param[in]	p_mir	- Pointer to mirror context
+* @return 		status 	- Status of operation, error when any page has both copies bad
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_mirror_scrub(_25lcxxxx_mirror_t * const p_mir)
+{
+	_25lcxxxx_status_t	status		= e25LCXXXX_OK;
+	bool				is_lost		= false;
+	uint8_t				buf_a[_25LCXXXX_CFG_PAGE_SIZE_BYTE];
+	uint8_t				buf_b[_25LCXXXX_CFG_PAGE_SIZE_BYTE];
+
+	_25LCXXXX_ASSERT( NULL != p_mir );
+	_25LCXXXX_ASSERT( true == p_mir->is_init );
+
+	for ( uint32_t page = 0UL; ( page < p_mir->page_num ) && ( e25LCXXXX_OK == status ); page++ )
+	{
+		const uint32_t page_addr = ( page * p_mir->page_size );
+
+		status = _25lcxxxx_dev_read( p_mir->p_dev[0], page_addr, p_mir->page_size, buf_a );
+
+		if ( e25LCXXXX_OK == status )
+		{
+			status = _25lcxxxx_dev_read( p_mir->p_dev[1], page_addr, p_mir->page_size, buf_b );
+		}
+
+		if ( e25LCXXXX_OK == status )
+		{
+			const _25lcxxxx_mirror_copy_t copy_a = _25lcxxxx_mirror_check( p_mir, buf_a );
+			const _25lcxxxx_mirror_copy_t copy_b = _25lcxxxx_mirror_check( p_mir, buf_b );
+
+			// Both valid but different - primary wins
+			if (	( e25LCXXXX_MIRROR_COPY_VALID == copy_a )
+				&&	( e25LCXXXX_MIRROR_COPY_VALID == copy_b )
+				&&	( 0 != memcmp( buf_a, buf_b, p_mir->page_size )))
+			{
+				status = _25lcxxxx_dev_write( p_mir->p_dev[1], page_addr, p_mir->page_size, buf_a );
+				p_mir->stats.repair_cnt++;
+			}
+
+			// Better copy on primary
+			else if ( copy_a > copy_b )
+			{
+				status = _25lcxxxx_dev_write( p_mir->p_dev[1], page_addr, p_mir->page_size, buf_a );
+				p_mir->stats.repair_cnt++;
+			}
+
+			// Better copy on secondary
+			else if ( copy_b > copy_a )
+			{
+				status = _25lcxxxx_dev_write( p_mir->p_dev[0], page_addr, p_mir->page_size, buf_b );
+				p_mir->stats.repair_cnt++;
+			}
+			else if ( e25LCXXXX_MIRROR_COPY_BAD == copy_a )
+			{
+				p_mir->stats.lost_cnt++;
+				is_lost = true;
+			}
+			else
+			{
+				// Both copies good & same
+			}
+		}
+	}
+
+	if (( e25LCXXXX_OK == status ) && ( true == is_lost ))
+	{
+		status = e25LCXXXX_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait for write cycles of both devices
+*
+* @param[in]	p_mir	- Pointer to mirror context
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_mirror_wait_ready(_25lcxxxx_mirror_t * const p_mir)
+{
+	_25LCXXXX_ASSERT( NULL != p_mir );
+	_25LCXXXX_ASSERT( true == p_mir->is_init );
+
+	return ( _25lcxxxx_dev_wait_ready( p_mir->p_dev[0] ) | _25lcxxxx_dev_wait_ready( p_mir->p_dev[1] ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_MIRROR_KERNEL
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Kernel functions of mirrored volume
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Load good copy of page
+*
+*	Page is read from device not in write cycle, primary when both are
+*	idle or busy. When copy fails checksum or is blank other copy is
+*	read as well and better of both is written over worse one.
+*
+* @param[in]	p_mir	- Pointer to mirror context
+* @param[in]	page	- Page number
+* @param[out]	p_buf	- Pointer to page buffer
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_mirror_load(_25lcxxxx_mirror_t * const p_mir, const uint32_t page, uint8_t * const p_buf)
+{
+	_25lcxxxx_status_t		status		= e25LCXXXX_OK;
+	uint32_t				first		= 0UL;
+	_25lcxxxx_mirror_copy_t	copy		= e25LCXXXX_MIRROR_COPY_BAD;
+	const uint32_t			page_addr	= ( page * p_mir->page_size );
+
+	// Primary busy - take secondary if that one is idle
+	if (	( true == _25lcxxxx_dev_is_busy( p_mir->p_dev[0] ))
+		&&	( false == _25lcxxxx_dev_is_busy( p_mir->p_dev[1] )))
+	{
+		first = 1UL;
+		p_mir->stats.busy_skip_cnt++;
+	}
+
+	status = _25lcxxxx_dev_read( p_mir->p_dev[first], page_addr, p_mir->page_size, p_buf );
+
+	if ( e25LCXXXX_OK == status )
+	{
+		copy = _25lcxxxx_mirror_check( p_mir, p_buf );
+	}
+
+	if (	( e25LCXXXX_OK == status )
+		&&	( e25LCXXXX_MIRROR_COPY_VALID != copy ))
+	{
+		status = _25lcxxxx_dev_read( p_mir->p_dev[ first ^ 1UL ], page_addr, p_mir->page_size, p_buf );
+
+		if ( e25LCXXXX_OK != status )
+		{
+			// Device failure
+		}
+		else
+		{
+			const _25lcxxxx_mirror_copy_t other = _25lcxxxx_mirror_check( p_mir, p_buf );
+
+			// Repair worse first copy
+			if ( other > copy )
+			{
+				status = _25lcxxxx_dev_write( p_mir->p_dev[first], page_addr, p_mir->page_size, p_buf );
+				p_mir->stats.repair_cnt++;
+			}
+
+			// Blank first copy over bad other one
+			else if ( copy > other )
+			{
+				memset( p_buf, 0xFF, p_mir->page_size );
+				status = _25lcxxxx_dev_write( p_mir->p_dev[ first ^ 1UL ], page_addr, p_mir->page_size, p_buf );
+				p_mir->stats.repair_cnt++;
+			}
+			else if ( e25LCXXXX_MIRROR_COPY_BAD == copy )
+			{
+				p_mir->stats.lost_cnt++;
+				status = e25LCXXXX_ERROR;
+			}
+			else
+			{
+				// Both copies blank
+			}
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Seal page with checksum and program it to both devices
+*
+*	Device write returns right after page program is started, so
+*	secondary device is programmed while primary is in write cycle.
+*
+* @param[in]	p_mir	- Pointer to mirror context
+* @param[in]	page	- Page number
+* @param[in]	p_buf	- Pointer to page buffer, checksum is added
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_mirror_program(_25lcxxxx_mirror_t * const p_mir, const uint32_t page, uint8_t * const p_buf)
+{
+	_25lcxxxx_status_t	status		= e25LCXXXX_OK;
+	const uint32_t		page_addr	= ( page * p_mir->page_size );
+	const uint32_t		crc			= _25lcxxxx_rec_crc32( 0UL, p_buf, p_mir->payload );
+
+	p_buf[ p_mir->payload + 0UL ] = (uint8_t) ( crc );
+	p_buf[ p_mir->payload + 1UL ] = (uint8_t) ( crc >> 8 );
+	p_buf[ p_mir->payload + 2UL ] = (uint8_t) ( crc >> 16 );
+	p_buf[ p_mir->payload + 3UL ] = (uint8_t) ( crc >> 24 );
+
+	status = _25lcxxxx_dev_write( p_mir->p_dev[0], page_addr, p_mir->page_size, p_buf );
+
+	if ( e25LCXXXX_OK == status )
+	{
+		status = _25lcxxxx_dev_write( p_mir->p_dev[1], page_addr, p_mir->page_size, p_buf );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Check page copy
+*
+* @param[in]	p_mir	- Pointer to mirror context
+* @param[in]	p_buf	- Pointer to page buffer
+* @return 		copy	- State of page copy
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_mirror_copy_t _25lcxxxx_mirror_check(const _25lcxxxx_mirror_t * const p_mir, const uint8_t * const p_buf)
+{
+	_25lcxxxx_mirror_copy_t	copy	= e25LCXXXX_MIRROR_COPY_VALID;
+	const uint32_t			crc		= _25lcxxxx_rec_crc32( 0UL, p_buf, p_mir->payload );
+
+	if (	( p_buf[ p_mir->payload + 0UL ] != (uint8_t) ( crc ))
+		||	( p_buf[ p_mir->payload + 1UL ] != (uint8_t) ( crc >> 8 ))
+		||	( p_buf[ p_mir->payload + 2UL ] != (uint8_t) ( crc >> 16 ))
+		||	( p_buf[ p_mir->payload + 3UL ] != (uint8_t) ( crc >> 24 )))
+	{
+		copy = e25LCXXXX_MIRROR_COPY_BLANK;
+
+		// Blank page
+		for ( uint32_t i = 0UL; i < p_mir->page_size; i++ )
+		{
+			if ( 0xFFU != p_buf[i] )
+			{
+				copy = e25LCXXXX_MIRROR_COPY_BAD;
+				break;
+			}
+		}
+	}
+
+	return copy;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,79 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_mirror.h
+*@brief    	Mirrored volume of two 25LCxxxx EEPROM devices
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_MIRROR
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _25LCXXXX_MIRROR_H_
+#define _25LCXXXX_MIRROR_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "25lcxxxx.h"
+#include "../../25lcxxxx_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Size of page checksum, stored at end of each page
+ *
+ * 	Unit: bytes
+ */
+#define _25LCXXXX_MIRROR_CRC_SIZE			( 4UL )
+
+/**
+ * 	Mirror statistics
+ */
+typedef struct
+{
+	uint32_t	repair_cnt;		/**<Number of pages copied over bad or outdated copy */
+	uint32_t	lost_cnt;		/**<Number of pages with both copies bad */
+	uint32_t	busy_skip_cnt;	/**<Number of page reads moved to other device as first one was in write cycle */
+} _25lcxxxx_mirror_stats_t;
+
+/**
+ * 	Mirrored volume
+ */
+typedef struct
+{
+	_25lcxxxx_dev_t *			p_dev[2];		/**<Primary & secondary device */
+	_25lcxxxx_mirror_stats_t	stats;			/**<Repair statistics */
+	uint32_t					size;			/**<Size of volume data in bytes */
+	uint32_t					page_num;		/**<Number of pages */
+	uint32_t					page_size;		/**<Page size of devices */
+	uint32_t					payload;		/**<Data bytes of page, without checksum */
+	bool						is_init;		/**<Volume initialized */
+} _25lcxxxx_mirror_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_mirror_init		(_25lcxxxx_mirror_t * const p_mir, _25lcxxxx_dev_t * const p_dev_a, _25lcxxxx_dev_t * const p_dev_b);
+_25lcxxxx_status_t _25lcxxxx_mirror_write		(_25lcxxxx_mirror_t * const p_mir, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_mirror_read		(_25lcxxxx_mirror_t * const p_mir, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_mirror_scrub		(_25lcxxxx_mirror_t * const p_mir);
+_25lcxxxx_status_t _25lcxxxx_mirror_wait_ready	(_25lcxxxx_mirror_t * const p_mir);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // _25LCXXXX_MIRROR_H_
@@ -0,0 +1,242 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_part.h
+*@brief    	Device profiles of 25LCxxxx/25AAxxxx EEPROM family
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_PART
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Profiles are taken from datasheets of each part. Maximum SPI clock is
+* 	given for highest supply voltage range (4.5V to 5.5V), it is lower
+* 	at lower supply voltage. 25LC and 25AA variants of same density are
+* 	same for driver.
+*
+* 	@note	Included from "25lcxxxx_cfg.h" after "_25LCXXXX_CFG_PART"
+* 			is defined. Profile of selected part is then available as
+* 			"_25LCXXXX_PART_..." constants.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _25LCXXXX_PART_H_
+#define _25LCXXXX_PART_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Part numbers
+ *
+ * 	@note	Custom part takes geometry from configuration by hand and
+ * 			from each device instance at runtime.
+ */
+#define _25LCXXXX_PART_CUSTOM					( 0 )
+#define _25LCXXXX_PART_25XX010A					( 1 )
+#define _25LCXXXX_PART_25XX020A					( 2 )
+#define _25LCXXXX_PART_25XX040A					( 3 )
+#define _25LCXXXX_PART_25XX080C					( 4 )
+#define _25LCXXXX_PART_25XX080D					( 5 )
+#define _25LCXXXX_PART_25XX160C					( 6 )
+#define _25LCXXXX_PART_25XX160D					( 7 )
+#define _25LCXXXX_PART_25XX320A					( 8 )
+#define _25LCXXXX_PART_25XX640A					( 9 )
+#define _25LCXXXX_PART_25XX128					( 10 )
+#define _25LCXXXX_PART_25XX256					( 11 )
+#define _25LCXXXX_PART_25XX512					( 12 )
+#define _25LCXXXX_PART_25XX1024					( 13 )
+
+/**
+ * 	Part numbers of 25LC and 25AA variants
+ */
+#define _25LCXXXX_PART_25LC010A					( _25LCXXXX_PART_25XX010A )
+#define _25LCXXXX_PART_25AA010A					( _25LCXXXX_PART_25XX010A )
+#define _25LCXXXX_PART_25LC020A					( _25LCXXXX_PART_25XX020A )
+#define _25LCXXXX_PART_25AA020A					( _25LCXXXX_PART_25XX020A )
+#define _25LCXXXX_PART_25LC040A					( _25LCXXXX_PART_25XX040A )
+#define _25LCXXXX_PART_25AA040A					( _25LCXXXX_PART_25XX040A )
+#define _25LCXXXX_PART_25LC080C					( _25LCXXXX_PART_25XX080C )
+#define _25LCXXXX_PART_25AA080C					( _25LCXXXX_PART_25XX080C )
+#define _25LCXXXX_PART_25LC080D					( _25LCXXXX_PART_25XX080D )
+#define _25LCXXXX_PART_25AA080D					( _25LCXXXX_PART_25XX080D )
+#define _25LCXXXX_PART_25LC160C					( _25LCXXXX_PART_25XX160C )
+#define _25LCXXXX_PART_25AA160C					( _25LCXXXX_PART_25XX160C )
+#define _25LCXXXX_PART_25LC160D					( _25LCXXXX_PART_25XX160D )
+#define _25LCXXXX_PART_25AA160D					( _25LCXXXX_PART_25XX160D )
+#define _25LCXXXX_PART_25LC320A					( _25LCXXXX_PART_25XX320A )
+#define _25LCXXXX_PART_25AA320A					( _25LCXXXX_PART_25XX320A )
+#define _25LCXXXX_PART_25LC640A					( _25LCXXXX_PART_25XX640A )
+#define _25LCXXXX_PART_25AA640A					( _25LCXXXX_PART_25XX640A )
+#define _25LCXXXX_PART_25LC128					( _25LCXXXX_PART_25XX128 )
+#define _25LCXXXX_PART_25AA128					( _25LCXXXX_PART_25XX128 )
+#define _25LCXXXX_PART_25LC256					( _25LCXXXX_PART_25XX256 )
+#define _25LCXXXX_PART_25AA256					( _25LCXXXX_PART_25XX256 )
+#define _25LCXXXX_PART_25LC512					( _25LCXXXX_PART_25XX512 )
+#define _25LCXXXX_PART_25AA512					( _25LCXXXX_PART_25XX512 )
+#define _25LCXXXX_PART_25LC1024					( _25LCXXXX_PART_25XX1024 )
+#define _25LCXXXX_PART_25AA1024					( _25LCXXXX_PART_25XX1024 )
+
+/**
+ * 	Supported instructions
+ */
+#define _25LCXXXX_PART_FEAT_PE					( 0x01 )	/**<Page erase */
+#define _25LCXXXX_PART_FEAT_SE					( 0x02 )	/**<Sector erase */
+#define _25LCXXXX_PART_FEAT_CE					( 0x04 )	/**<Chip erase */
+#define _25LCXXXX_PART_FEAT_DPD					( 0x08 )	/**<Deep power-down */
+#define _25LCXXXX_PART_FEAT_RDID				( 0x10 )	/**<Release from deep power-down & read electronic signature */
+
+/**
+ * 	Extended instruction set (25XX512 & 25XX1024)
+ */
+#define _25LCXXXX_PART_FEAT_EXT_ISA				(	_25LCXXXX_PART_FEAT_PE | _25LCXXXX_PART_FEAT_SE | _25LCXXXX_PART_FEAT_CE \
+												|	_25LCXXXX_PART_FEAT_DPD | _25LCXXXX_PART_FEAT_RDID )
+
+/**
+ * 	Profile of selected part
+ *
+ * 	Address bits, page size in bytes, maximum write cycle time in
+ * 	microseconds, maximum SPI clock in Hz and supported instructions.
+ */
+#if ( _25LCXXXX_PART_CUSTOM == _25LCXXXX_CFG_PART )
+
+	// Geometry by hand...
+
+#elif ( _25LCXXXX_PART_25XX010A == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 7 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 16 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX020A == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 8 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 16 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX040A == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 9 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 16 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX080C == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 10 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 16 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX080D == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 10 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 32 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX160C == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 11 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 16 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX160D == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 11 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 32 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX320A == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 12 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 32 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX640A == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 13 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 32 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX128 == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 14 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 64 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX256 == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 15 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 64 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 10000000 )
+	#define _25LCXXXX_PART_FEAT					( 0 )
+
+#elif ( _25LCXXXX_PART_25XX512 == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 16 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 128 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 5000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 20000000 )
+	#define _25LCXXXX_PART_FEAT					( _25LCXXXX_PART_FEAT_EXT_ISA )
+
+#elif ( _25LCXXXX_PART_25XX1024 == _25LCXXXX_CFG_PART )
+
+	#define _25LCXXXX_PART_ADDR_BIT_NUM			( 17 )
+	#define _25LCXXXX_PART_PAGE_SIZE			( 256 )
+	#define _25LCXXXX_PART_TWC_MAX_US			( 6000 )
+	#define _25LCXXXX_PART_SPI_CLK_MAX_HZ		( 20000000 )
+	#define _25LCXXXX_PART_FEAT					( _25LCXXXX_PART_FEAT_EXT_ISA )
+
+#else
+	#error "25LCXXXX Configuration Failure: Unknown part!"
+#endif
+
+#if ( _25LCXXXX_PART_CUSTOM != _25LCXXXX_CFG_PART )
+
+	/**
+	 * 	Size of read/write command of selected part
+	 *
+	 * 	Instruction with A8 for 7-9 address bits, two address bytes for
+	 * 	10-16 and three for 17 address bits.
+	 */
+	#if ( _25LCXXXX_PART_ADDR_BIT_NUM <= 9 )
+		#define _25LCXXXX_PART_CMD_SIZE			( 2 )
+	#elif ( _25LCXXXX_PART_ADDR_BIT_NUM <= 16 )
+		#define _25LCXXXX_PART_CMD_SIZE			( 3 )
+	#else
+		#define _25LCXXXX_PART_CMD_SIZE			( 4 )
+	#endif
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // _25LCXXXX_PART_H_
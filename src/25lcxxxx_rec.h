@@ -0,0 +1,73 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_rec.h
+*@brief    	CRC protected records on 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_REC
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _25LCXXXX_REC_H_
+#define _25LCXXXX_REC_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "25lcxxxx.h"
+#include "../../25lcxxxx_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Size of record header
+ *
+ * 	Magic (1), length (2), sequence (4) and CRC-32 (4)
+ *
+ * 	Unit: bytes
+ */
+#define _25LCXXXX_REC_HDR_SIZE				( 11UL )
+
+/**
+ * 	Largest record data
+ *
+ * 	Unit: bytes
+ */
+#define _25LCXXXX_REC_DATA_SIZE_MAX			( 0xFFFFUL )
+
+/**
+ * 	Record header fields
+ */
+typedef struct
+{
+	uint32_t	seq;	/**<Sequence number */
+	uint32_t	crc;	/**<CRC-32 of length, sequence and data */
+	uint16_t	len;	/**<Data length */
+} _25lcxxxx_rec_hdr_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t 	_25lcxxxx_rec_write		(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t seq, const uint32_t size, const uint8_t * const p_data);
+_25lcxxxx_status_t 	_25lcxxxx_rec_read		(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, uint8_t * const p_data, const uint32_t size, _25lcxxxx_rec_hdr_t * const p_hdr);
+_25lcxxxx_status_t 	_25lcxxxx_rec_read_hdr	(_25lcxxxx_dev_t * const p_dev, const uint32_t addr, _25lcxxxx_rec_hdr_t * const p_hdr);
+uint32_t			_25lcxxxx_rec_crc32		(const uint32_t crc, const uint8_t * const p_data, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // _25LCXXXX_REC_H_
@@ -7,7 +7,7 @@
 *@brief     Register description of 25LCxxxx devices
 *@author    Ziga Miklosic
 *@date      08.05.2021
-*@version	V1.0.2
+*@version	V1.1.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -0,0 +1,360 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_stream.c
+*@brief     Sequential stream writer and reader for 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_STREAM
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Sequential stream cursors on top of 25LCxxxx API
+*
+* 	Writer appends data to RAM copy of current page and programs it only
+* 	when page is filled or on explicit flush, so that page of small log
+* 	records takes single write cycle. Appends starting at page boundary
+* 	that cover whole pages are programmed directly from caller buffer.
+*
+* 	Reader fetches "_25LCXXXX_CFG_STREAM_RA_SIZE" bytes ahead with single
+* 	read command and serves following small reads from that buffer.
+*
+* 	@note	Readahead buffer is not updated by writes. Reader shall be
+* 			reopened after its region was written.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "25lcxxxx_stream.h"
+#include "../../25lcxxxx_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Open stream writer
+*
+* @param[in]	p_w		- Pointer to writer cursor
+* @param[in]	p_dev	- Pointer to initialized device
+* @param[in]	addr	- Start address of stream region
+* @param[in]	size	- Size of stream region
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_stream_w_open(_25lcxxxx_stream_w_t * const p_w, _25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size)
+{
+	_25LCXXXX_ASSERT( NULL != p_w );
+	_25LCXXXX_ASSERT( NULL != p_dev );
+	_25LCXXXX_ASSERT( true == _25lcxxxx_dev_is_init( p_dev ));
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT(( addr + size - 1 ) <= p_dev->max_addr );
+
+	// Page must fit into buffer
+	_25LCXXXX_ASSERT( p_dev->cfg.page_size <= _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+
+	p_w->p_dev 		= p_dev;
+	p_w->addr 		= addr;
+	p_w->end 		= addr + size;
+	p_w->fill 		= 0UL;
+	p_w->is_open 	= true;
+
+	return e25LCXXXX_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Append byte(s) to stream
+*
+* @note		Data is programmed when page is filled. Until then it is only
+* 			copied into writer buffer.
+*
+* @note		When program of filled page fails, bytes of that page from
+* 			this call are not appended. Page is programmed again by
+* 			next append or flush.
+*
+* @param[in]	p_w		- Pointer to writer cursor
+* @param[in]	size	- Size of bytes to append
+* @param[in]	p_data	- Pointer to data
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_stream_w_append(_25lcxxxx_stream_w_t * const p_w, const uint32_t size, const uint8_t * const p_data)
+{
+	_25lcxxxx_status_t	status			= e25LCXXXX_OK;
+	uint32_t			working_size	= size;
+	uint32_t			data_offset		= 0UL;
+
+	_25LCXXXX_ASSERT( NULL != p_w );
+	_25LCXXXX_ASSERT( true == p_w->is_open );
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT( NULL != p_data );
+
+	const uint32_t page_size = p_w->p_dev->cfg.page_size;
+	const uint32_t page_mask = p_w->p_dev->page_mask;
+
+	// Stream region full
+	if ( size > ( p_w->end - p_w->addr ))
+	{
+		status = e25LCXXXX_ERROR_ADDR;
+	}
+
+	// Filled page of failed flush - program it before buffering more
+	else if (	( p_w->fill > 0UL )
+			&&	( 0UL == ( p_w->addr & page_mask )))
+	{
+		status = _25lcxxxx_stream_w_flush( p_w );
+	}
+	else
+	{
+		// No actions...
+	}
+
+	while (( working_size > 0UL ) && ( e25LCXXXX_OK == status ))
+	{
+		const uint32_t offset = ( p_w->addr & page_mask );
+
+		// Whole pages - program directly from caller buffer
+		if (	( 0UL == p_w->fill )
+			&&	( 0UL == offset )
+			&&	( working_size >= page_size ))
+		{
+			const uint32_t chunk = ( working_size & ~page_mask );
+
+			status = _25lcxxxx_dev_write( p_w->p_dev, p_w->addr, chunk, ( p_data + data_offset ));
+
+			if ( e25LCXXXX_OK == status )
+			{
+				p_w->addr 		+= chunk;
+				data_offset 	+= chunk;
+				working_size 	-= chunk;
+			}
+		}
+		else
+		{
+			const uint32_t chunk = ( working_size < ( page_size - offset )) ? working_size : ( page_size - offset );
+
+			memcpy( &p_w->buf[ p_w->fill ], ( p_data + data_offset ), chunk );
+
+			p_w->fill 		+= chunk;
+			p_w->addr 		+= chunk;
+			data_offset 	+= chunk;
+			working_size 	-= chunk;
+
+			// Page filled
+			if ( 0UL == ( p_w->addr & page_mask ))
+			{
+				status = _25lcxxxx_stream_w_flush( p_w );
+
+				// Chunk not appended, rest of page stays buffered for retry
+				if ( e25LCXXXX_OK != status )
+				{
+					p_w->fill 	-= chunk;
+					p_w->addr 	-= chunk;
+				}
+			}
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Program buffered part of page
+*
+* @note		Following appends continue in same page, which is then
+* 			programmed again when filled.
+*
+* @param[in]	p_w		- Pointer to writer cursor
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_stream_w_flush(_25lcxxxx_stream_w_t * const p_w)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	_25LCXXXX_ASSERT( NULL != p_w );
+	_25LCXXXX_ASSERT( true == p_w->is_open );
+
+	if ( p_w->fill > 0UL )
+	{
+		status = _25lcxxxx_dev_write( p_w->p_dev, ( p_w->addr - p_w->fill ), p_w->fill, p_w->buf );
+
+		// Keep data for retry on failure
+		if ( e25LCXXXX_OK == status )
+		{
+			p_w->fill = 0UL;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Flush and close stream writer
+*
+* @param[in]	p_w		- Pointer to writer cursor
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_stream_w_close(_25lcxxxx_stream_w_t * const p_w)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	status = _25lcxxxx_stream_w_flush( p_w );
+
+	if ( e25LCXXXX_OK == status )
+	{
+		p_w->is_open = false;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Open stream reader
+*
+* @param[in]	p_r		- Pointer to reader cursor
+* @param[in]	p_dev	- Pointer to initialized device
+* @param[in]	addr	- Start address of stream region
+* @param[in]	size	- Size of stream region
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_stream_r_open(_25lcxxxx_stream_r_t * const p_r, _25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size)
+{
+	_25LCXXXX_ASSERT( NULL != p_r );
+	_25LCXXXX_ASSERT( NULL != p_dev );
+	_25LCXXXX_ASSERT( true == _25lcxxxx_dev_is_init( p_dev ));
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT(( addr + size - 1 ) <= p_dev->max_addr );
+
+	p_r->p_dev 		= p_dev;
+	p_r->addr 		= addr;
+	p_r->end 		= addr + size;
+	p_r->len 		= 0UL;
+	p_r->pos 		= 0UL;
+	p_r->is_open 	= true;
+
+	return e25LCXXXX_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read byte(s) from stream
+*
+* @brief	Reads are served from readahead buffer. When it is empty it is
+* 			refilled with single read command, except when requested size
+* 			is at least size of buffer, then data is read directly.
+*
+* @param[in]	p_r		- Pointer to reader cursor
+* @param[in]	size	- Size of bytes to read
+* @param[out]	p_data	- Pointer to read data
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_stream_r_read(_25lcxxxx_stream_r_t * const p_r, const uint32_t size, uint8_t * const p_data)
+{
+	_25lcxxxx_status_t	status			= e25LCXXXX_OK;
+	uint32_t			working_size	= size;
+	uint32_t			data_offset		= 0UL;
+
+	_25LCXXXX_ASSERT( NULL != p_r );
+	_25LCXXXX_ASSERT( true == p_r->is_open );
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT( NULL != p_data );
+
+	// End of stream region
+	if ( size > ( p_r->end - p_r->addr ))
+	{
+		status = e25LCXXXX_ERROR_ADDR;
+	}
+
+	while (( working_size > 0UL ) && ( e25LCXXXX_OK == status ))
+	{
+		uint32_t chunk = 0UL;
+
+		// Serve from readahead buffer
+		if ( p_r->len > 0UL )
+		{
+			chunk = ( working_size < p_r->len ) ? working_size : p_r->len;
+
+			memcpy(( p_data + data_offset ), &p_r->buf[ p_r->pos ], chunk );
+
+			p_r->pos += chunk;
+			p_r->len -= chunk;
+		}
+
+		// Large read - directly into caller buffer
+		else if ( working_size >= _25LCXXXX_CFG_STREAM_RA_SIZE )
+		{
+			chunk = working_size;
+
+			status = _25lcxxxx_dev_read( p_r->p_dev, p_r->addr, chunk, ( p_data + data_offset ));
+		}
+
+		// Refill readahead buffer
+		else
+		{
+			const uint32_t len = (( p_r->end - p_r->addr ) < _25LCXXXX_CFG_STREAM_RA_SIZE ) ? ( p_r->end - p_r->addr ) : _25LCXXXX_CFG_STREAM_RA_SIZE;
+
+			status = _25lcxxxx_dev_read( p_r->p_dev, p_r->addr, len, p_r->buf );
+
+			if ( e25LCXXXX_OK == status )
+			{
+				p_r->pos = 0UL;
+				p_r->len = len;
+			}
+		}
+
+		if ( e25LCXXXX_OK == status )
+		{
+			p_r->addr 		+= chunk;
+			data_offset 	+= chunk;
+			working_size 	-= chunk;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Close stream reader
+*
+* @param[in]	p_r		- Pointer to reader cursor
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_stream_r_close(_25lcxxxx_stream_r_t * const p_r)
+{
+	_25LCXXXX_ASSERT( NULL != p_r );
+
+	p_r->len 		= 0UL;
+	p_r->is_open 	= false;
+
+	return e25LCXXXX_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
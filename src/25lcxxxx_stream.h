@@ -0,0 +1,77 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_stream.h
+*@brief    	Sequential stream writer and reader for 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_STREAM
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _25LCXXXX_STREAM_H_
+#define _25LCXXXX_STREAM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "25lcxxxx.h"
+#include "../../25lcxxxx_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Stream writer cursor
+ */
+typedef struct
+{
+	_25lcxxxx_dev_t *	p_dev;									/**<Underlying device */
+	uint32_t			addr;									/**<Address of next appended byte */
+	uint32_t			end;									/**<One past last address of stream region */
+	uint32_t			fill;									/**<Number of buffered bytes, ending at "addr" */
+	uint8_t				buf[_25LCXXXX_CFG_PAGE_SIZE_BYTE];		/**<Buffered part of current page */
+	bool				is_open;								/**<Cursor opened */
+} _25lcxxxx_stream_w_t;
+
+/**
+ * 	Stream reader cursor
+ */
+typedef struct
+{
+	_25lcxxxx_dev_t *	p_dev;									/**<Underlying device */
+	uint32_t			addr;									/**<Address of next read byte */
+	uint32_t			end;									/**<One past last address of stream region */
+	uint32_t			len;									/**<Number of buffered bytes, starting at "addr" */
+	uint32_t			pos;									/**<Position of "addr" in buffer */
+	uint8_t				buf[_25LCXXXX_CFG_STREAM_RA_SIZE];		/**<Readahead buffer */
+	bool				is_open;								/**<Cursor opened */
+} _25lcxxxx_stream_r_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_stream_w_open		(_25lcxxxx_stream_w_t * const p_w, _25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size);
+_25lcxxxx_status_t _25lcxxxx_stream_w_append	(_25lcxxxx_stream_w_t * const p_w, const uint32_t size, const uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_stream_w_flush		(_25lcxxxx_stream_w_t * const p_w);
+_25lcxxxx_status_t _25lcxxxx_stream_w_close		(_25lcxxxx_stream_w_t * const p_w);
+_25lcxxxx_status_t _25lcxxxx_stream_r_open		(_25lcxxxx_stream_r_t * const p_r, _25lcxxxx_dev_t * const p_dev, const uint32_t addr, const uint32_t size);
+_25lcxxxx_status_t _25lcxxxx_stream_r_read		(_25lcxxxx_stream_r_t * const p_r, const uint32_t size, uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_stream_r_close		(_25lcxxxx_stream_r_t * const p_r);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // _25LCXXXX_STREAM_H_
@@ -0,0 +1,274 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_vol.c
+*@brief     Striped volume of multiple 25LCxxxx EEPROM devices
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_VOL
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Striped volume on top of 25LCxxxx API
+*
+* 	Identical devices, each on own chip select, are presented as single
+* 	linear address space. Consecutive pages of volume are placed on
+* 	consecutive devices, page N of volume is page (N / chip_num) of
+* 	device (N % chip_num). Write is split into pages as by device write
+* 	and each page program waits only for write cycle of its own device,
+* 	so write cycles of different devices overlap and write throughput
+* 	scales with number of devices.
+*
+* 	@note	Devices shall be accessed only through volume, otherwise
+* 			striped data is overwritten.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "25lcxxxx_vol.h"
+#include "../../25lcxxxx_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t 	_25lcxxxx_vol_map	(const _25lcxxxx_vol_t * const p_vol, const uint32_t addr, const uint32_t size, uint32_t * const p_chip, uint32_t * const p_chip_addr);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize striped volume
+*
+* @note		All devices must be initialized and have same size and page size.
+*
+* @param[in]	p_vol		- Pointer to volume context
+* @param[in]	pp_dev		- Array of pointers to initialized devices
+* @param[in]	chip_num	- Number of devices
+* @return 		status 		- Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_vol_init(_25lcxxxx_vol_t * const p_vol, _25lcxxxx_dev_t * const * const pp_dev, const uint32_t chip_num)
+{
+	_25lcxxxx_status_t	status		= e25LCXXXX_OK;
+	uint32_t			size		= 0UL;
+	uint16_t			page_size	= 0U;
+	uint32_t			dev_size	= 0UL;
+	uint16_t			dev_page	= 0U;
+
+	_25LCXXXX_ASSERT( NULL != p_vol );
+	_25LCXXXX_ASSERT( NULL != pp_dev );
+	_25LCXXXX_ASSERT(( chip_num > 0UL ) && ( chip_num <= _25LCXXXX_CFG_VOL_CHIP_NUM_MAX ));
+
+	p_vol->is_init = false;
+
+	for ( uint32_t i = 0; ( i < chip_num ) && ( e25LCXXXX_OK == status ); i++ )
+	{
+		_25LCXXXX_ASSERT( NULL != pp_dev[i] );
+
+		if ( true != _25lcxxxx_dev_is_init( pp_dev[i] ))
+		{
+			status = e25LCXXXX_ERROR_INIT;
+		}
+		else
+		{
+			(void) _25lcxxxx_dev_get_geometry( pp_dev[i], &dev_size, &dev_page );
+
+			if ( 0UL == i )
+			{
+				size 		= dev_size;
+				page_size 	= dev_page;
+			}
+
+			// Devices must be identical
+			else if (( dev_size != size ) || ( dev_page != page_size ))
+			{
+				status = e25LCXXXX_ERROR_INIT;
+			}
+			else
+			{
+				// No actions...
+			}
+
+			p_vol->p_dev[i] = pp_dev[i];
+		}
+	}
+
+	if ( e25LCXXXX_OK == status )
+	{
+		p_vol->chip_num 	= chip_num;
+		p_vol->size 		= size * chip_num;
+		p_vol->page_size 	= page_size;
+		p_vol->is_init 		= true;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write byte(s) to striped volume
+*
+* @note		Function returns after last page program is started, same as
+* 			device write. Use "_25lcxxxx_vol_wait_ready" to wait for
+* 			write cycles of all devices.
+*
+* @param[in]	p_vol	- Pointer to volume context
+* @param[in]	addr	- Start address of write
+* @param[in]	size	- Size of bytes to write
+* @param[in]	p_data	- Pointer to write data
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_vol_write(_25lcxxxx_vol_t * const p_vol, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	_25lcxxxx_status_t	status			= e25LCXXXX_OK;
+	uint32_t			working_addr	= addr;
+	uint32_t			working_size	= size;
+	uint32_t			data_offset		= 0UL;
+	uint32_t			chip			= 0UL;
+	uint32_t			chip_addr		= 0UL;
+
+	_25LCXXXX_ASSERT( NULL != p_vol );
+	_25LCXXXX_ASSERT( true == p_vol->is_init );
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT(( addr + size ) <= p_vol->size );
+	_25LCXXXX_ASSERT( NULL != p_data );
+
+	// Page by page, rotating over devices
+	while (( working_size > 0UL ) && ( e25LCXXXX_OK == status ))
+	{
+		const uint32_t chunk = _25lcxxxx_vol_map( p_vol, working_addr, working_size, &chip, &chip_addr );
+
+		// Waits only for write cycle of that device
+		status = _25lcxxxx_dev_write( p_vol->p_dev[chip], chip_addr, chunk, ( p_data + data_offset ));
+
+		data_offset 	+= chunk;
+		working_addr 	+= chunk;
+		working_size 	-= chunk;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read byte(s) from striped volume
+*
+* @param[in]	p_vol	- Pointer to volume context
+* @param[in]	addr	- Start address of read
+* @param[in]	size	- Size of bytes to read
+* @param[out]	p_data	- Pointer to read data
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_vol_read(_25lcxxxx_vol_t * const p_vol, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+	_25lcxxxx_status_t	status			= e25LCXXXX_OK;
+	uint32_t			working_addr	= addr;
+	uint32_t			working_size	= size;
+	uint32_t			data_offset		= 0UL;
+	uint32_t			chip			= 0UL;
+	uint32_t			chip_addr		= 0UL;
+
+	_25LCXXXX_ASSERT( NULL != p_vol );
+	_25LCXXXX_ASSERT( true == p_vol->is_init );
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT(( addr + size ) <= p_vol->size );
+	_25LCXXXX_ASSERT( NULL != p_data );
+
+	while (( working_size > 0UL ) && ( e25LCXXXX_OK == status ))
+	{
+		const uint32_t chunk = _25lcxxxx_vol_map( p_vol, working_addr, working_size, &chip, &chip_addr );
+
+		status = _25lcxxxx_dev_read( p_vol->p_dev[chip], chip_addr, chunk, ( p_data + data_offset ));
+
+		data_offset 	+= chunk;
+		working_addr 	+= chunk;
+		working_size 	-= chunk;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Wait for write cycles of all devices of volume
+*
+* @param[in]	p_vol	- Pointer to volume context
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_vol_wait_ready(_25lcxxxx_vol_t * const p_vol)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	_25LCXXXX_ASSERT( NULL != p_vol );
+	_25LCXXXX_ASSERT( true == p_vol->is_init );
+
+	for ( uint32_t i = 0; i < p_vol->chip_num; i++ )
+	{
+		status |= _25lcxxxx_dev_wait_ready( p_vol->p_dev[i] );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_VOL_KERNEL
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Kernel functions of striped volume
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Map volume address to device
+*
+* @param[in]	p_vol		- Pointer to volume context
+* @param[in]	addr		- Volume address
+* @param[in]	size		- Remaining size of access
+* @param[out]	p_chip		- Index of device
+* @param[out]	p_chip_addr	- Address on device
+* @return 		chunk		- Bytes till end of page or end of access
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t _25lcxxxx_vol_map(const _25lcxxxx_vol_t * const p_vol, const uint32_t addr, const uint32_t size, uint32_t * const p_chip, uint32_t * const p_chip_addr)
+{
+	// Offset inside page is same on volume and device
+	const uint32_t page_mask	= p_vol->p_dev[0]->page_mask;
+	const uint32_t offset 		= ( addr & page_mask );
+	const uint32_t page 		= (( addr & ~page_mask ) / p_vol->page_size );
+	const uint32_t chunk		= ( page_mask + 1UL ) - offset;
+
+	*p_chip 		= ( page % p_vol->chip_num );
+	*p_chip_addr 	= (( page / p_vol->chip_num ) * p_vol->page_size ) + offset;
+
+	return ( chunk < size ) ? chunk : size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,59 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_vol.h
+*@brief    	Striped volume of multiple 25LCxxxx EEPROM devices
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_VOL
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _25LCXXXX_VOL_H_
+#define _25LCXXXX_VOL_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "25lcxxxx.h"
+#include "../../25lcxxxx_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Striped volume
+ */
+typedef struct
+{
+	_25lcxxxx_dev_t *	p_dev[_25LCXXXX_CFG_VOL_CHIP_NUM_MAX];		/**<Member devices, in stripe order */
+	uint32_t			chip_num;									/**<Number of member devices */
+	uint32_t			size;										/**<Size of volume in bytes */
+	uint32_t			page_size;									/**<Page size of member devices, stripe unit */
+	bool				is_init;									/**<Volume initialized */
+} _25lcxxxx_vol_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_vol_init		(_25lcxxxx_vol_t * const p_vol, _25lcxxxx_dev_t * const * const pp_dev, const uint32_t chip_num);
+_25lcxxxx_status_t _25lcxxxx_vol_write		(_25lcxxxx_vol_t * const p_vol, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_vol_read		(_25lcxxxx_vol_t * const p_vol, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_vol_wait_ready	(_25lcxxxx_vol_t * const p_vol);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // _25LCXXXX_VOL_H_
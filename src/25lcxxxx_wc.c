@@ -0,0 +1,421 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_wc.c
+*@brief     Write combining layer for 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_WC
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Write combining layer on top of 25LCxxxx API
+*
+* 	Small writes are merged into RAM images of pages and each page is
+* 	programmed only once, on explicit flush, when write is older than
+* 	"_25LCXXXX_CFG_WC_FLUSH_TIMEOUT_MS", when dirty part of page reaches
+* 	"_25LCXXXX_CFG_WC_FLUSH_SIZE" or when page is evicted from buffer.
+*
+* 	@note	All accesses to buffered area shall go through this layer,
+* 			otherwise page images are not coherent with device.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include "25lcxxxx_wc.h"
+#include "../../25lcxxxx_if.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_wc_slot_t * 	_25lcxxxx_wc_find_slot		(_25lcxxxx_wc_t * const p_wc, const uint32_t page_addr);
+static _25lcxxxx_status_t 		_25lcxxxx_wc_get_slot		(_25lcxxxx_wc_t * const p_wc, const uint32_t page_addr, _25lcxxxx_wc_slot_t ** const pp_slot);
+static _25lcxxxx_status_t 		_25lcxxxx_wc_flush_slot		(_25lcxxxx_wc_t * const p_wc, _25lcxxxx_wc_slot_t * const p_slot);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Initialize write combining layer
+*
+* @param[in]	p_wc	- Pointer to write combining context
+* @param[in]	p_dev	- Pointer to initialized device
+* @return 		status 	- Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_wc_init(_25lcxxxx_wc_t * const p_wc, _25lcxxxx_dev_t * const p_dev)
+{
+	_25LCXXXX_ASSERT( NULL != p_wc );
+	_25LCXXXX_ASSERT( NULL != p_dev );
+	_25LCXXXX_ASSERT( true == _25lcxxxx_dev_is_init( p_dev ));
+
+	// Page image must fit into slot
+	_25LCXXXX_ASSERT( p_dev->cfg.page_size <= _25LCXXXX_CFG_PAGE_SIZE_BYTE );
+
+	p_wc->p_dev 	= p_dev;
+	p_wc->use_cnt	= 0UL;
+
+	for ( uint32_t i = 0; i < _25LCXXXX_CFG_WC_SLOT_NUM; i++ )
+	{
+		p_wc->slot[i].valid 		= false;
+		p_wc->slot[i].dirty_start 	= 0U;
+		p_wc->slot[i].dirty_end 	= 0U;
+	}
+
+	p_wc->is_init = true;
+
+	return e25LCXXXX_OK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Write byte(s) through write combining layer
+*
+* @note		Data is only copied into page images. Device is programmed later.
+*
+* @param[in]	p_wc	- Pointer to write combining context
+* @param[in]	addr	- Start address of write
+* @param[in]	size	- Size of bytes to write
+* @param[in]	p_data	- Pointer to write data
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_wc_write(_25lcxxxx_wc_t * const p_wc, const uint32_t addr, const uint32_t size, const uint8_t * const p_data)
+{
+	_25lcxxxx_status_t		status			= e25LCXXXX_OK;
+	_25lcxxxx_wc_slot_t *	p_slot			= NULL;
+	uint32_t				working_addr	= addr;
+	uint32_t				working_size	= size;
+	uint32_t				data_offset		= 0UL;
+
+	_25LCXXXX_ASSERT( NULL != p_wc );
+	_25LCXXXX_ASSERT( true == p_wc->is_init );
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT( NULL != p_data );
+
+	const uint32_t page_size = p_wc->p_dev->cfg.page_size;
+	const uint32_t page_mask = p_wc->p_dev->page_mask;
+
+	while (( working_size > 0UL ) && ( e25LCXXXX_OK == status ))
+	{
+		const uint32_t offset 		= ( working_addr & page_mask );
+		const uint32_t page_addr 	= ( working_addr - offset );
+		const uint32_t chunk 		= ( working_size < ( page_size - offset )) ? working_size : ( page_size - offset );
+
+		status = _25lcxxxx_wc_get_slot( p_wc, page_addr, &p_slot );
+
+		if ( e25LCXXXX_OK == status )
+		{
+			// Merge data into page image
+			memcpy( &p_slot->data[offset], ( p_data + data_offset ), chunk );
+
+			// First dirty write - start flush timeout
+			if ( p_slot->dirty_start == p_slot->dirty_end )
+			{
+				p_slot->tick 		= p_wc->p_dev->cfg.p_if->pf_get_sys_time_ms();
+				p_slot->dirty_start = (uint16_t) offset;
+				p_slot->dirty_end 	= (uint16_t) ( offset + chunk );
+			}
+			else
+			{
+				if ( offset < p_slot->dirty_start )
+				{
+					p_slot->dirty_start = (uint16_t) offset;
+				}
+				if (( offset + chunk ) > p_slot->dirty_end )
+				{
+					p_slot->dirty_end = (uint16_t) ( offset + chunk );
+				}
+			}
+
+			// Size threshold reached
+			if (( p_slot->dirty_end - p_slot->dirty_start ) >= _25LCXXXX_CFG_WC_FLUSH_SIZE )
+			{
+				status = _25lcxxxx_wc_flush_slot( p_wc, p_slot );
+			}
+
+			data_offset 	+= chunk;
+			working_addr 	+= chunk;
+			working_size 	-= chunk;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Read byte(s) through write combining layer
+*
+* @note		Read data includes all not yet flushed writes.
+*
+* @param[in]	p_wc	- Pointer to write combining context
+* @param[in]	addr	- Start address of read
+* @param[in]	size	- Size of bytes to read
+* @param[out]	p_data	- Pointer to read data
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_wc_read(_25lcxxxx_wc_t * const p_wc, const uint32_t addr, const uint32_t size, uint8_t * const p_data)
+{
+	_25lcxxxx_status_t		status	= e25LCXXXX_OK;
+	_25lcxxxx_wc_slot_t *	p_slot	= NULL;
+
+	_25LCXXXX_ASSERT( NULL != p_wc );
+	_25LCXXXX_ASSERT( true == p_wc->is_init );
+	_25LCXXXX_ASSERT( size > 0 );
+	_25LCXXXX_ASSERT( NULL != p_data );
+
+	const uint32_t page_mask = p_wc->p_dev->page_mask;
+
+	// Whole read inside single buffered page - no need to access device
+	if (( addr & ~page_mask ) == (( addr + size - 1UL ) & ~page_mask ))
+	{
+		p_slot = _25lcxxxx_wc_find_slot( p_wc, ( addr & ~page_mask ));
+	}
+
+	if ( NULL != p_slot )
+	{
+		memcpy( p_data, &p_slot->data[ addr & page_mask ], size );
+	}
+	else
+	{
+		// Read from device
+		status = _25lcxxxx_dev_read( p_wc->p_dev, addr, size, p_data );
+
+		// Overlay buffered pages
+		for ( uint32_t i = 0; ( i < _25LCXXXX_CFG_WC_SLOT_NUM ) && ( e25LCXXXX_OK == status ); i++ )
+		{
+			p_slot = &p_wc->slot[i];
+
+			if ( true == p_slot->valid )
+			{
+				const uint32_t page_end = p_slot->page_addr + p_wc->p_dev->cfg.page_size;
+				const uint32_t start 	= ( addr > p_slot->page_addr ) ? addr : p_slot->page_addr;
+				const uint32_t end 		= (( addr + size ) < page_end ) ? ( addr + size ) : page_end;
+
+				if ( start < end )
+				{
+					memcpy(( p_data + ( start - addr )), &p_slot->data[ start - p_slot->page_addr ], ( end - start ));
+				}
+			}
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Program all dirty pages to device
+*
+* @param[in]	p_wc	- Pointer to write combining context
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_wc_flush(_25lcxxxx_wc_t * const p_wc)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	_25LCXXXX_ASSERT( NULL != p_wc );
+	_25LCXXXX_ASSERT( true == p_wc->is_init );
+
+	for ( uint32_t i = 0; i < _25LCXXXX_CFG_WC_SLOT_NUM; i++ )
+	{
+		status |= _25lcxxxx_wc_flush_slot( p_wc, &p_wc->slot[i] );
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Process write combining layer
+*
+* @brief	Shall be called periodically. Programs pages that were not
+* 			flushed for longer than "_25LCXXXX_CFG_WC_FLUSH_TIMEOUT_MS".
+*
+* @param[in]	p_wc	- Pointer to write combining context
+* @return 		status 	- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_wc_process(_25lcxxxx_wc_t * const p_wc)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	_25LCXXXX_ASSERT( NULL != p_wc );
+	_25LCXXXX_ASSERT( true == p_wc->is_init );
+
+	const uint32_t tick = p_wc->p_dev->cfg.p_if->pf_get_sys_time_ms();
+
+	for ( uint32_t i = 0; i < _25LCXXXX_CFG_WC_SLOT_NUM; i++ )
+	{
+		if (	( p_wc->slot[i].dirty_start != p_wc->slot[i].dirty_end )
+			&&	((uint32_t) ( tick - p_wc->slot[i].tick ) >= _25LCXXXX_CFG_WC_FLUSH_TIMEOUT_MS ))
+		{
+			status |= _25lcxxxx_wc_flush_slot( p_wc, &p_wc->slot[i] );
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_WC_KERNEL
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Kernel functions of write combining layer
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Find slot holding page
+*
+* @param[in]	p_wc		- Pointer to write combining context
+* @param[in]	page_addr	- Start address of page
+* @return 		p_slot		- Pointer to slot, NULL if page is not buffered
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_wc_slot_t * _25lcxxxx_wc_find_slot(_25lcxxxx_wc_t * const p_wc, const uint32_t page_addr)
+{
+	_25lcxxxx_wc_slot_t * p_slot = NULL;
+
+	for ( uint32_t i = 0; i < _25LCXXXX_CFG_WC_SLOT_NUM; i++ )
+	{
+		if (	( true == p_wc->slot[i].valid )
+			&&	( page_addr == p_wc->slot[i].page_addr ))
+		{
+			p_slot = &p_wc->slot[i];
+			p_slot->last_use = ++p_wc->use_cnt;
+			break;
+		}
+	}
+
+	return p_slot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Get slot for page
+*
+*	Returns slot already holding page. Otherwise least recently used slot
+*	is flushed and page image is loaded from device into it.
+*
+* @param[in]	p_wc		- Pointer to write combining context
+* @param[in]	page_addr	- Start address of page
+* @param[out]	pp_slot		- Pointer to slot
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_wc_get_slot(_25lcxxxx_wc_t * const p_wc, const uint32_t page_addr, _25lcxxxx_wc_slot_t ** const pp_slot)
+{
+	_25lcxxxx_status_t		status	= e25LCXXXX_OK;
+	_25lcxxxx_wc_slot_t *	p_slot	= NULL;
+
+	p_slot = _25lcxxxx_wc_find_slot( p_wc, page_addr );
+
+	if ( NULL == p_slot )
+	{
+		// Select free or least recently used slot
+		p_slot = &p_wc->slot[0];
+
+		for ( uint32_t i = 0; i < _25LCXXXX_CFG_WC_SLOT_NUM; i++ )
+		{
+			if ( false == p_wc->slot[i].valid )
+			{
+				p_slot = &p_wc->slot[i];
+				break;
+			}
+			else if ( p_wc->slot[i].last_use < p_slot->last_use )
+			{
+				p_slot = &p_wc->slot[i];
+			}
+			else
+			{
+				// No actions...
+			}
+		}
+
+		// Evict
+		status = _25lcxxxx_wc_flush_slot( p_wc, p_slot );
+
+		// Load page image
+		if ( e25LCXXXX_OK == status )
+		{
+			p_slot->valid = false;
+
+			status = _25lcxxxx_dev_read( p_wc->p_dev, page_addr, p_wc->p_dev->cfg.page_size, p_slot->data );
+
+			if ( e25LCXXXX_OK == status )
+			{
+				p_slot->page_addr 	= page_addr;
+				p_slot->valid 		= true;
+				p_slot->last_use 	= ++p_wc->use_cnt;
+			}
+		}
+	}
+
+	*pp_slot = p_slot;
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*		Program dirty part of page
+*
+* @param[in]	p_wc		- Pointer to write combining context
+* @param[in]	p_slot		- Pointer to slot
+* @return 		status 		- Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static _25lcxxxx_status_t _25lcxxxx_wc_flush_slot(_25lcxxxx_wc_t * const p_wc, _25lcxxxx_wc_slot_t * const p_slot)
+{
+	_25lcxxxx_status_t status = e25LCXXXX_OK;
+
+	if (	( true == p_slot->valid )
+		&&	( p_slot->dirty_start != p_slot->dirty_end ))
+	{
+		status = _25lcxxxx_dev_write( 	p_wc->p_dev,
+										( p_slot->page_addr + p_slot->dirty_start ),
+										(uint32_t) ( p_slot->dirty_end - p_slot->dirty_start ),
+										&p_slot->data[ p_slot->dirty_start ] );
+
+		if ( e25LCXXXX_OK == status )
+		{
+			p_slot->dirty_start = 0U;
+			p_slot->dirty_end 	= 0U;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
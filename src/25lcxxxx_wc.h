@@ -0,0 +1,73 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      25lcxxxx_wc.h
+*@brief    	Write combining layer for 25LCxxxx EEPROM device
+*@author    Ziga Miklosic
+*@date      16.10.2026
+*@version	V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup _25LCXXXX_WC
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _25LCXXXX_WC_H_
+#define _25LCXXXX_WC_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "25lcxxxx.h"
+#include "../../25lcxxxx_cfg.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Page buffer slot
+ */
+typedef struct
+{
+	uint32_t	page_addr;								/**<Start address of buffered page */
+	uint32_t	tick;									/**<Timetick of first not flushed write */
+	uint32_t	last_use;								/**<Usage stamp for LRU eviction */
+	uint16_t	dirty_start;							/**<Offset of first dirty byte */
+	uint16_t	dirty_end;								/**<Offset of one past last dirty byte */
+	bool		valid;									/**<Page image loaded */
+	uint8_t		data[_25LCXXXX_CFG_PAGE_SIZE_BYTE];		/**<Page image */
+} _25lcxxxx_wc_slot_t;
+
+/**
+ * 	Write combining context
+ */
+typedef struct
+{
+	_25lcxxxx_dev_t *		p_dev;								/**<Underlying device */
+	_25lcxxxx_wc_slot_t		slot[_25LCXXXX_CFG_WC_SLOT_NUM];	/**<Page buffer slots */
+	uint32_t				use_cnt;							/**<Usage counter */
+	bool					is_init;							/**<Initialization guard */
+} _25lcxxxx_wc_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions Prototypes
+////////////////////////////////////////////////////////////////////////////////
+_25lcxxxx_status_t _25lcxxxx_wc_init		(_25lcxxxx_wc_t * const p_wc, _25lcxxxx_dev_t * const p_dev);
+_25lcxxxx_status_t _25lcxxxx_wc_write		(_25lcxxxx_wc_t * const p_wc, const uint32_t addr, const uint32_t size, const uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_wc_read		(_25lcxxxx_wc_t * const p_wc, const uint32_t addr, const uint32_t size, uint8_t * const p_data);
+_25lcxxxx_status_t _25lcxxxx_wc_flush		(_25lcxxxx_wc_t * const p_wc);
+_25lcxxxx_status_t _25lcxxxx_wc_process		(_25lcxxxx_wc_t * const p_wc);
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#endif // _25LCXXXX_WC_H_